@@ -1,29 +1,5 @@
 #include "sort.h"
 
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
-
 /**
  * bubble_sort - Sorts an array of integers in ascending order using
  * the Bubble Sort algorithm.
@@ -62,7 +38,7 @@ void bubble_sort(int *array, size_t size)
 			if (array[j] > array[j + 1])
 			{
 				swap(&array[j], &array[j + 1]);
-				print_array(array, size);
+				TRACE_ARRAY(array, size);
 				swapped = 1;
 			}
 		}
@@ -1,8 +1,5 @@
 #include "sort.h"
 
-void swap(int *a, int *b);
-void swap_with_pre_node(listint_t **list, listint_t *node);
-
 /**
  * insertion_sort_list - Sorts a doubly linked list of integers
  * in ascending order using the Insertion Sort algorithm.
@@ -35,74 +32,8 @@ void insertion_sort_list(listint_t **list)
 		curr = curr->next;
 		while (prev->prev && prev->n < prev->prev->n)
 		{
-			swap_with_pre_node(list, prev);
-			print_list((const listint_t *)(*list));
+			list_swap_prev(list, prev);
+			TRACE_LIST((const listint_t *)(*list));
 		}
 	}
 }
-
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
-
-/**
- * swap_with_pre_node - Swaps a node with its previous node
- * in a doubly linked list.
- *
- * @list: Pointer to a pointer to the head of the linked list.
- * @node: Pointer to the node to be swapped.
- *
- * Description:
- * This function swaps the given node with its previous node in a
- * doubly linked list. It updates the pointers accordingly to maintain
- * the integrity of the linked list.
- *
- * Note:
- * - The input pointers `list` and `node` must be valid.
- * - The linked list must be doubly linked.
- * - The given node must be part of the linked list.
- *
- */
-void swap_with_pre_node(listint_t **list, listint_t *node)
-{
-	listint_t *pre_node;
-
-	if (!list || !*list || !node || !node->prev)
-		return;
-
-	pre_node = node->prev;
-
-	pre_node->next = node->next;
-	node->prev = pre_node->prev;
-
-	if (node->next)
-		node->next->prev = pre_node;
-
-	if (pre_node->prev)
-		pre_node->prev->next = node;
-	else
-		*list = node;
-
-	pre_node->prev = node;
-	node->next = pre_node;
-}
@@ -1,7 +1,6 @@
 #include "sort.h"
 
-size_t get_max_gap(size_t size);
-void swap(int *a, int *b);
+static size_t get_max_gap(size_t size);
 
 /**
  * shell_sort - Sorts an array of integers in ascending order using
@@ -34,7 +33,7 @@ void shell_sort(int *array, size_t size)
 				swap(&array[j - gap], &array[j]);
 		}
 
-		print_array(array, size);
+		TRACE_ARRAY(array, size);
 	}
 }
 
@@ -55,7 +54,7 @@ void shell_sort(int *array, size_t size)
  *
  * Return: The initial maximum gap for Shell Sort.
  */
-size_t get_max_gap(size_t size)
+static size_t get_max_gap(size_t size)
 {
 	size_t gap = 1;
 
@@ -66,27 +65,3 @@ size_t get_max_gap(size_t size)
 
 	return ((gap - 1) / 3);
 }
-
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
@@ -13,59 +13,22 @@
  *
  * Return: void (no return value).
  *
- * Note: The function assumes the `deck.h` header file is included,
- * which defines the `deck_node_t` structure used for the linked list
- * nodes and the `card_t` structure representing each card.
+ * Note: The cards are distributed into (suit, rank) buckets by
+ * deck_sort_buckets: linear time, no comparison and no allocation. Any
+ * number of cards works, including several decks or missing cards, and
+ * equal cards keep their order.
  */
 void sort_deck(deck_node_t **deck)
 {
-	size_t list_size = 0, i;
-	deck_node_t *curr, **card_array, **card_sub_array;
-
-	if (!deck || !*deck)
-		return;
-
-	curr = *deck;
-	while (curr)
-	{
-		list_size++;
-		curr = curr->next;
-	}
-
-	card_array = malloc(sizeof(*card_array) * (list_size + 1));
-	if (!card_array)
-		return;
-
-	curr = *deck;
-	i = 0;
-	while (curr)
-	{
-		card_array[i++] = curr;
-		curr = curr->next;
-	}
-	card_array[i] = NULL;
-
-	qsort(card_array, list_size, sizeof(*card_array), compare_cards_kind);
-	for (card_sub_array = card_array; *card_sub_array; card_sub_array += 13)
-		qsort(card_sub_array, 13, sizeof(*card_sub_array), compare_cards_value);
-
-	*deck = card_array[0];
-	card_array[0]->prev = NULL;
-	for (i = 1; i < list_size; i++)
-	{
-		card_array[i]->prev = card_array[i - 1];
-		card_array[i - 1]->next = card_array[i];
-	}
-	card_array[list_size - 1]->next = NULL;
-
-	free(card_array);
+	if (deck)
+		deck_sort_buckets(deck, NULL);
 }
 
 /**
  * compare_cards_kind -  Compares two cards based on their suit.
  *
- * This function is used as a comparison function for `qsort` during
- * the first sorting pass based on suit. It takes two pointers to `deck_node_t`
+ * This function can be used as a comparison function for `qsort`
+ * to order cards by suit. It takes two pointers to `deck_node_t`
  * structures as arguments, representing cards in the deck.
  *
  * @a: A pointer to the first card to compare.
@@ -93,10 +56,9 @@ int compare_cards_kind(const void *a, const void *b)
  * compare_cards_value - Compares two cards based on their value
  * within the same suit.
  *
- * This function is used as a comparison function for `qsort`
- * during the second sorting pass based on value
- * within each suit. It takes two pointers to `deck_node_t`
- * structures as arguments, representing cards in the deck.
+ * This function can be used as a comparison function for `qsort`
+ * to order the cards of one suit by value. It takes two pointers to
+ * `deck_node_t` structures as arguments, representing cards in the deck.
  *
  * @a: A pointer to the first card to compare.
  * @b: A pointer to the second card to compare.
@@ -108,10 +70,9 @@ int compare_cards_kind(const void *a, const void *b)
  * - Positive: If the first card's value is greater than the
  * second card's value.
  *
- * Note: This function uses static arrays for card names and
- * values for efficiency. It also handles cases where
- * the card value is not one of the predefined names
- * ("Ace", "Jack", "Queen", "King").
+ * Note: The values are ranked by card_rank, which parses each one
+ * with at most one _strcmp or _atoi; values that are not a card
+ * compare greater than the King.
  * This function assumes the `deck.h` header file is included, which defines
  * the `deck_node_t` structure
  * and the `card_t` structure containing the `value` member for the card value.
@@ -121,24 +82,8 @@ int compare_cards_value(const void *a, const void *b)
 	const deck_node_t *node1 = *(const deck_node_t **)a;
 	const deck_node_t *node2 = *(const deck_node_t **)b;
 
-	static char *cards[] = {"Ace", "Jack", "Queen", "King", NULL};
-	static int values[] = {0, 11, 12, 13};
-	int i = 0, node1_compare_value = -1, node2_compare_value = -1;
-
-	for (i = 0; cards[i]; i++)
-	{
-		if (_strcmp(cards[i], node1->card->value) == 0)
-			node1_compare_value = values[i];
-		if (_strcmp(cards[i], node2->card->value) == 0)
-			node2_compare_value = values[i];
-	}
-
-	if (node1_compare_value == -1)
-		node1_compare_value = _atoi(node1->card->value);
-	if (node2_compare_value == -1)
-		node2_compare_value = _atoi(node2->card->value);
-
-	return (node1_compare_value - node2_compare_value);
+	return ((int)card_rank(node1->card->value) -
+		(int)card_rank(node2->card->value));
 }
 
 /**
@@ -1,9 +1,7 @@
 #include "sort.h"
 
-int swap_right(listint_t **list, listint_t **start, listint_t **end);
-int swap_left(listint_t **list, listint_t **start, listint_t **end);
-void swap_with_next_node(listint_t **list, listint_t *node);
-void swap_with_pre_node(listint_t **list, listint_t *node);
+static int swap_right(listint_t **list, listint_t **start, listint_t **end);
+static int swap_left(listint_t **list, listint_t **start, listint_t **end);
 
 /**
  * cocktail_sort_list - Sorts a doubly linked list of integers
@@ -57,7 +55,7 @@ void cocktail_sort_list(listint_t **list)
  *
  * Return: 1 if any swaps occurred, 0 otherwise.
  */
-int swap_right(listint_t **list, listint_t **start, listint_t **end)
+static int swap_right(listint_t **list, listint_t **start, listint_t **end)
 {
 	listint_t *curr = *start;
 	int swapped = 0;
@@ -69,13 +67,13 @@ int swap_right(listint_t **list, listint_t **start, listint_t **end)
 	{
 		if (curr->next && curr->n > curr->next->n)
 		{
-			swap_with_next_node(list, curr);
+			list_swap_next(list, curr);
 			if (curr == *start)
 				*start = curr->prev;
 
 			swapped = 1;
 
-			print_list((const listint_t *)(*list));
+			TRACE_LIST((const listint_t *)(*list));
 		}
 		else if (curr->prev != *end)
 			curr = curr->next;
@@ -105,7 +103,7 @@ int swap_right(listint_t **list, listint_t **start, listint_t **end)
  *
  * Return: 1 if any swaps occurred, 0 otherwise.
  */
-int swap_left(listint_t **list, listint_t **start, listint_t **end)
+static int swap_left(listint_t **list, listint_t **start, listint_t **end)
 {
 	listint_t *curr = *end;
 	int swapped = 0;
@@ -117,13 +115,13 @@ int swap_left(listint_t **list, listint_t **start, listint_t **end)
 	{
 		if (curr->prev && curr->n < curr->prev->n)
 		{
-			swap_with_pre_node(list, curr);
+			list_swap_prev(list, curr);
 			if (curr == *end)
 				*end = curr->next;
 
 			swapped = 1;
 
-			print_list((const listint_t *)(*list));
+			TRACE_LIST((const listint_t *)(*list));
 		}
 		else if (curr->next != *start)
 			curr = curr->prev;
@@ -136,86 +134,3 @@ int swap_left(listint_t **list, listint_t **start, listint_t **end)
 
 	return (swapped);
 }
-
-/**
- * swap_with_next_node - Swaps a node with its next node
- * in a doubly linked list.
- *
- * @list: Pointer to a pointer to the head of the linked list.
- * @node: Pointer to the node to be swapped.
- *
- * Description:
- * This function swaps the given node with its next node in
- * a doubly linked list. It updates the pointers accordingly to
- * maintain the integrity of the linked list.
- *
- * Note:
- * - The input pointers `list` and `node` must be valid.
- * - The linked list must be doubly linked.
- * - The given node and its next node must be part of the linked list.
- */
-void swap_with_next_node(listint_t **list, listint_t *node)
-{
-	listint_t *next_node;
-
-	if (!list || !*list || !node || !node->next)
-		return;
-
-	next_node = node->next;
-
-	node->next = next_node->next;
-	next_node->prev = node->prev;
-
-	if (node->prev)
-		node->prev->next = next_node;
-	else
-		*list = next_node;
-
-	if (next_node->next)
-		next_node->next->prev = node;
-
-	node->prev = next_node;
-	next_node->next = node;
-}
-
-/**
- * swap_with_pre_node - Swaps a node with its previous node
- * in a doubly linked list.
- *
- * @list: Pointer to a pointer to the head of the linked list.
- * @node: Pointer to the node to be swapped.
- *
- * Description:
- * This function swaps the given node with its previous node in a
- * doubly linked list. It updates the pointers accordingly to maintain
- * the integrity of the linked list.
- *
- * Note:
- * - The input pointers `list` and `node` must be valid.
- * - The linked list must be doubly linked.
- * - The given node must be part of the linked list.
- *
- */
-void swap_with_pre_node(listint_t **list, listint_t *node)
-{
-	listint_t *pre_node;
-
-	if (!list || !*list || !node || !node->prev)
-		return;
-
-	pre_node = node->prev;
-
-	pre_node->next = node->next;
-	node->prev = pre_node->prev;
-
-	if (node->next)
-		node->next->prev = pre_node;
-
-	if (pre_node->prev)
-		pre_node->prev->next = node;
-	else
-		*list = node;
-
-	pre_node->prev = node;
-	node->next = pre_node;
-}
@@ -1,8 +1,8 @@
 #include "sort.h"
 
-int get_max(int *array, size_t size);
-int get_min(int *array, size_t size);
-char *_memset(char *array, char byte, size_t size);
+static int get_max(int *array, size_t size);
+static int get_min(int *array, size_t size);
+static char *_memset(char *array, char byte, size_t size);
 
 /**
  * counting_sort - Sorts an array of integers using the counting
@@ -51,7 +51,7 @@ void counting_sort(int *array, size_t size)
 	for (i = 1; i < range; i++)
 		counter[i] += counter[i - 1];
 
-	print_array(counter, range);
+	TRACE_ARRAY(counter, range);
 
 	for (i = size - 1; (int)i >= 0; i--)
 	{
@@ -75,7 +75,7 @@ void counting_sort(int *array, size_t size)
  * @size: size Size of the array.
  * Return: The maximum value in the array.
  */
-int get_max(int *array, size_t size)
+static int get_max(int *array, size_t size)
 {
 	size_t i = 0;
 	int max;
@@ -100,7 +100,7 @@ int get_max(int *array, size_t size)
  * @size: size Size of the array.
  * Return: The minimum value in the array.
  */
-int get_min(int *array, size_t size)
+static int get_min(int *array, size_t size)
 {
 	size_t i = 0;
 	int min;
@@ -127,7 +127,7 @@ int get_min(int *array, size_t size)
  * @size: size Number of bytes to set.
  * Return: Pointer to the modified array.
  */
-char *_memset(char *array, char byte, size_t size)
+static char *_memset(char *array, char byte, size_t size)
 {
 	size_t i;
 
@@ -1,7 +1,8 @@
 #include "sort.h"
 
-void _merge_sort(int *array, int *buffer, size_t left, size_t right);
-void merge(int *array, int *buffer, size_t left, size_t mid, size_t right);
+static void _merge_sort(int *array, int *buffer, size_t left, size_t right);
+static void merge(int *array, int *buffer,
+		  size_t left, size_t mid, size_t right);
 
 /**
  * merge_sort - Sorts an array of integers using the merge sort algorithm.
@@ -45,7 +46,7 @@ void merge_sort(int *array, size_t size)
  * @right: right Index of the rightmost element + 1 (exclusive) in
  * the current sub-array.
  */
-void _merge_sort(int *array, int *buffer, size_t left, size_t right)
+static void _merge_sort(int *array, int *buffer, size_t left, size_t right)
 {
 	size_t mid;
 
@@ -67,9 +68,9 @@ void _merge_sort(int *array, int *buffer, size_t left, size_t right)
  * merges them into a single sorted sub-array in the original array. It uses
  * a temporary buffer to hold elements during the merging process.
  *
- * The function prints debugging information during the merge process,
+ * The function traces debugging information during the merge process,
  * which can be helpful for visualization and understanding the algorithm.
- * (Note: This printing can be disabled if desired.)
+ * (Note: This tracing is compiled out when SORT_NO_TRACE is defined.)
  *
  * @array: array Pointer to the array of integers containing sub-arrays.
  * @buffer: buffer Pointer to the temporary buffer for merging.
@@ -79,17 +80,18 @@ void _merge_sort(int *array, int *buffer, size_t left, size_t right)
  * @right: right Index of the rightmost element + 1 (exclusive)
  * in the second sub-array.
  */
-void merge(int *array, int *buffer, size_t left, size_t mid, size_t right)
+static void merge(int *array, int *buffer,
+		  size_t left, size_t mid, size_t right)
 {
 	size_t i, j, low = left, high = mid;
 
-	printf("Merging...\n");
+	TRACE_MESSAGE(("Merging...\n"));
 
-	printf("[left]: ");
-	print_array(array + left, mid - left);
+	TRACE_MESSAGE(("[left]: "));
+	TRACE_ARRAY(array + left, mid - left);
 
-	printf("[right]: ");
-	print_array(array + mid, right - mid);
+	TRACE_MESSAGE(("[right]: "));
+	TRACE_ARRAY(array + mid, right - mid);
 
 	for (i = 0; low < mid || high < right; i++)
 	{
@@ -102,6 +104,66 @@ void merge(int *array, int *buffer, size_t left, size_t mid, size_t right)
 	for (i = left, j = 0; i < right; i++, j++)
 		array[i] = buffer[j];
 
-	printf("[Done]: ");
-	print_array(array + left, right - left);
+	TRACE_MESSAGE(("[Done]: "));
+	TRACE_ARRAY(array + left, right - left);
+}
+
+/**
+ * merge_k - Merges K sorted arrays into one sorted array in a single pass.
+ *
+ * This function keeps the head of every array in a loser tree, so each
+ * output element costs log2(K) comparisons on the path of the previous
+ * winner only, instead of merging the arrays two by two or sorting
+ * their concatenation again. Equal elements are taken from the array
+ * with the lower index first, so the merge is stable.
+ *
+ * If the tree cannot be allocated, the arrays are concatenated and
+ * sorted with heap_sort_bottom_up, which needs no memory.
+ *
+ * @spans: spans Pointer to the K sorted arrays (an array may be empty).
+ * @count: count Number of arrays, K.
+ * @output: output Pointer to the destination, which must hold the sum
+ * of the sizes of the arrays and must not overlap them.
+ */
+void merge_k(const int_span_t *spans, size_t count, int *output)
+{
+	size_t total = 0, i, winner;
+	int_span_t *heads;
+	loser_tree_t tree;
+
+	for (i = 0; i < count; i++)
+		total += spans[i].size;
+	if (!output || !total)
+		return;
+
+	heads = malloc(sizeof(*heads) * count);
+	if (!heads || loser_tree_init(&tree, count))
+	{
+		for (i = 0, total = 0; i < count; total += spans[i++].size)
+			memcpy(output + total, spans[i].array,
+			       sizeof(int) * spans[i].size);
+		heap_sort_bottom_up(output, total, 0);
+		free(heads);
+		return;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		heads[i] = spans[i];
+		if (heads[i].size)
+			tree.keys[i] = *heads[i].array;
+	}
+	loser_tree_build(&tree);
+	for (i = 0; i < total; i++)
+	{
+		winner = tree.winner;
+		output[i] = (int)tree.keys[winner];
+		heads[winner].array++;
+		tree.keys[winner] = --heads[winner].size ?
+			*heads[winner].array : LOSER_TREE_DONE;
+		loser_tree_replay(&tree);
+	}
+
+	loser_tree_destroy(&tree);
+	free(heads);
 }
@@ -1,7 +1,6 @@
 #include "sort.h"
 
-void heapify(int *array, size_t boundary, size_t parent, size_t size);
-void swap(int *a, int *b);
+static void heapify(int *array, size_t boundary, size_t parent, size_t size);
 
 /**
  * heap_sort - Sorts an array of integers in ascending order
@@ -28,7 +27,7 @@ void heap_sort(int *array, size_t size)
 	for (i = size - 1; i >= 1; i--)
 	{
 		swap(&array[0], &array[i]);
-		print_array(array, size);
+		TRACE_ARRAY(array, size);
 		heapify(array, i - 1, 0, size);
 	}
 }
@@ -46,7 +45,7 @@ void heap_sort(int *array, size_t size)
  * property is checked.
  * @size: size Size of the whole array
  */
-void heapify(int *array, size_t boundary, size_t parent, size_t size)
+static void heapify(int *array, size_t boundary, size_t parent, size_t size)
 {
 	size_t left_child = parent * 2 + 1;
 	size_t right_child = parent * 2 + 2;
@@ -61,31 +60,7 @@ void heapify(int *array, size_t boundary, size_t parent, size_t size)
 	if (smallest != parent)
 	{
 		swap(&array[parent], &array[smallest]);
-		print_array(array, size);
+		TRACE_ARRAY(array, size);
 		heapify(array, boundary, smallest, size);
 	}
 }
-
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
@@ -1,7 +1,7 @@
 #include "sort.h"
 
-int get_max(int *array, int size);
-void counting_digit_sort(int *array, int exp, int *buffer, size_t size);
+static int get_max(int *array, int size);
+static void counting_digit_sort(int *array, int exp, int *buffer, size_t size);
 
 /**
  * radix_sort -  Performs radix sort on an array of integers.
@@ -28,7 +28,7 @@ void radix_sort(int *array, size_t size)
 	for (exp = 1; max / exp > 0; exp *= 10)
 	{
 		counting_digit_sort(array, exp, buffer, size);
-		print_array(array, size);
+		TRACE_ARRAY(array, size);
 	}
 
 	free(buffer);
@@ -41,7 +41,7 @@ void radix_sort(int *array, size_t size)
  * @size: size Number of elements in the array.
  * Return: The maximum value in the array.
  */
-int get_max(int *array, int size)
+static int get_max(int *array, int size)
 {
 	int max, i;
 
@@ -65,7 +65,7 @@ int get_max(int *array, int size)
  * @buffer: buffer Temporary buffer array for intermediate storage.
  * @size: size Number of elements in the array.
  */
-void counting_digit_sort(int *array, int exp, int *buffer, size_t size)
+static void counting_digit_sort(int *array, int exp, int *buffer, size_t size)
 {
 	int counter[10] = {0};
 	size_t i;
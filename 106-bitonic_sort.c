@@ -1,9 +1,9 @@
 #include "sort.h"
 
-void _bitonic_sort(int *array, size_t size, size_t start,
+static void _bitonic_sort(int *array, size_t size, size_t start,
 		   size_t sequence_size, int flow);
-void bitonic_merge(int *array, size_t start, size_t sequence_size, int flow);
-void swap(int *a, int *b);
+static void bitonic_merge(int *array, size_t start,
+			  size_t sequence_size, int flow);
 
 /**
  * bitonic_sort - Sorts an array using the Bitonic Sort algorithm.
@@ -16,13 +16,21 @@ void swap(int *a, int *b);
  * @size: size Number of elements in the array
  *
  * Note:The array is sorted in-place. The input array must not be NULL,
- * and the size should be at least 2.
+ * and the size should be at least 2. The traced network only exists for
+ * powers of 2; any other size is sorted, untraced, by
+ * bitonic_sort_network.
  */
 void bitonic_sort(int *array, size_t size)
 {
 	if (!array || size < 2)
 		return;
 
+	if (size & (size - 1))
+	{
+		bitonic_sort_network(array, size);
+		return;
+	}
+
 	_bitonic_sort(array, size, 0, size, UP);
 }
 
@@ -44,28 +52,28 @@ void bitonic_sort(int *array, size_t size)
  * The input array must not be NULL, and the sequence size
  * should be at least 2.
  */
-void _bitonic_sort(int *array, size_t size, size_t start,
+static void _bitonic_sort(int *array, size_t size, size_t start,
 		   size_t sequence_size, int flow)
 {
 	size_t cut;
-	char *dir;
 
 	if (sequence_size <= 1)
 		return;
 
 	cut = sequence_size / 2;
-	dir = flow == UP ? "UP" : "DOWN";
 
-	printf("Merging [%lu/%lu] (%s):\n", sequence_size, size, dir);
-	print_array(array + start, sequence_size);
+	TRACE_MESSAGE(("Merging [%lu/%lu] (%s):\n", sequence_size, size,
+		       flow == UP ? "UP" : "DOWN"));
+	TRACE_ARRAY(array + start, sequence_size);
 
 	_bitonic_sort(array, size, start, cut, UP);
 	_bitonic_sort(array, size, start + cut, cut, DOWN);
 
 	bitonic_merge(array, start, sequence_size, flow);
 
-	printf("Result [%lu/%lu] (%s):\n", sequence_size, size, dir);
-	print_array(array + start, sequence_size);
+	TRACE_MESSAGE(("Result [%lu/%lu] (%s):\n", sequence_size, size,
+		       flow == UP ? "UP" : "DOWN"));
+	TRACE_ARRAY(array + start, sequence_size);
 }
 
 /**
@@ -84,7 +92,8 @@ void _bitonic_sort(int *array, size_t size, size_t start,
  * The input array must not be NULL, and the sequence size
  * should be at least 2.
  */
-void bitonic_merge(int *array, size_t start, size_t sequence_size, int flow)
+static void bitonic_merge(int *array, size_t start,
+			  size_t sequence_size, int flow)
 {
 	size_t jump = sequence_size / 2, i;
 
@@ -101,27 +110,3 @@ void bitonic_merge(int *array, size_t start, size_t sequence_size, int flow)
 	bitonic_merge(array, start, jump, flow);
 	bitonic_merge(array, start + jump, jump, flow);
 }
-
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
@@ -1,8 +1,7 @@
 #include "sort.h"
 
-void _quick_sort_hoare(int *array, size_t size, int left, int right);
-int hoare_partition(int *array, size_t size, int left, int right);
-void swap(int *a, int *b);
+static void _quick_sort_hoare(int *array, size_t size, int left, int right);
+static int hoare_partition(int *array, size_t size, int left, int right);
 
 /**
  * quick_sort_hoare - Sorts an array of integers using the Hoare
@@ -37,7 +36,7 @@ void quick_sort_hoare(int *array, size_t size)
  *
  * Note: The input array must not be NULL, and the indices should be valid.
  */
-void _quick_sort_hoare(int *array, size_t size, int left, int right)
+static void _quick_sort_hoare(int *array, size_t size, int left, int right)
 {
 	int pivot;
 
@@ -66,7 +65,7 @@ void _quick_sort_hoare(int *array, size_t size, int left, int right)
  *
  * Return: The index of the pivot after partitioning.
  */
-int hoare_partition(int *array, size_t size, int left, int right)
+static int hoare_partition(int *array, size_t size, int left, int right)
 {
 	int pivot = array[right];
 
@@ -85,33 +84,9 @@ int hoare_partition(int *array, size_t size, int left, int right)
 		if (left < right)
 		{
 			swap(&array[left], &array[right]);
-			print_array(array, size);
+			TRACE_ARRAY(array, size);
 		}
 	}
 
 	return (left);
 }
-
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
@@ -0,0 +1,183 @@
+#include "sort.h"
+
+static void _introsort(int *array, size_t size, size_t left, size_t right,
+		       size_t depth);
+static size_t intro_partition(int *array, size_t size, size_t left,
+			      size_t right);
+static size_t choose_pivot(int *array, size_t left, size_t right);
+static size_t median_of_three(int *array, size_t a, size_t b, size_t c);
+
+/**
+ * introsort - Sorts an array of integers in ascending order using
+ * the Introsort algorithm.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the array.
+ *
+ * Description:
+ * Introsort is a quick sort that cannot degrade: the pivot is a median
+ * of three (or a ninther on large sub-arrays), only the smaller side is
+ * sorted recursively, and once the recursion gets deeper than
+ * 2 * log2(size) the sub-array is handed to heap_sort_bottom_up.
+ * Sub-arrays of INTROSORT_THRESHOLD elements or less are finished by
+ * small_sort.
+ * The array is traced after every partition.
+ *
+ * Note:
+ * - The input array must be a valid array of integers.
+ */
+void introsort(int *array, size_t size)
+{
+	size_t depth = 0, n;
+
+	if (!array || size < 2)
+		return;
+
+	for (n = size; n > 1; n >>= 1)
+		depth += 2;
+
+	_introsort(array, size, 0, size, depth);
+}
+
+/**
+ * _introsort - Sorts a sub-array, recursing only on its smaller side.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the whole array.
+ * @left: Index of the first element of the sub-array.
+ * @right: Index of the last element + 1 (exclusive) of the sub-array.
+ * @depth: Number of partitions left before heap_sort_bottom_up.
+ *
+ * Description:
+ * The larger side is handled by the loop instead of a recursive call,
+ * which bounds the stack to O(log n) frames.
+ */
+static void _introsort(int *array, size_t size, size_t left, size_t right,
+		       size_t depth)
+{
+	size_t pivot;
+
+	while (right - left > INTROSORT_THRESHOLD)
+	{
+		if (depth == 0)
+		{
+			heap_sort_bottom_up(array + left, right - left, 0);
+			return;
+		}
+		depth--;
+
+		pivot = intro_partition(array, size, left, right);
+
+		if (pivot - left < right - pivot)
+		{
+			_introsort(array, size, left, pivot, depth);
+			left = pivot + 1;
+		}
+		else
+		{
+			_introsort(array, size, pivot + 1, right, depth);
+			right = pivot;
+		}
+	}
+
+	small_sort(array + left, right - left);
+}
+
+/**
+ * intro_partition - Partitions a sub-array around its chosen pivot.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the whole array.
+ * @left: Index of the first element of the sub-array.
+ * @right: Index of the last element + 1 (exclusive) of the sub-array.
+ *
+ * Description:
+ * The pivot is moved to `left` and the sub-array is partitioned with
+ * two converging scans (Hoare). Elements equal to the pivot stop both
+ * scans, so runs of duplicates are split evenly instead of piling up
+ * on one side.
+ *
+ * Return: The final index of the pivot.
+ */
+static size_t intro_partition(int *array, size_t size, size_t left,
+			      size_t right)
+{
+	size_t low = left, high = right;
+	int pivot;
+
+	swap(&array[left], &array[choose_pivot(array, left, right)]);
+	pivot = array[left];
+
+	while (1)
+	{
+		do {
+			low++;
+		} while (low < right && array[low] < pivot);
+
+		do {
+			high--;
+		} while (array[high] > pivot);
+
+		if (low >= high)
+			break;
+		swap(&array[low], &array[high]);
+	}
+
+	swap(&array[left], &array[high]);
+	TRACE_ARRAY(array, size);
+
+	return (high);
+}
+
+/**
+ * choose_pivot - Picks a pivot index for a sub-array.
+ *
+ * @array: Pointer to the first element of the array.
+ * @left: Index of the first element of the sub-array.
+ * @right: Index of the last element + 1 (exclusive) of the sub-array.
+ *
+ * Description:
+ * Small sub-arrays use the median of their first, middle and last
+ * elements. Larger ones use Tukey's ninther, the median of three such
+ * medians, which resists sorted, reversed and organ-pipe inputs.
+ *
+ * Return: The index of the chosen pivot.
+ */
+static size_t choose_pivot(int *array, size_t left, size_t right)
+{
+	size_t mid = left + (right - left) / 2, last = right - 1, step;
+
+	if (right - left < INTROSORT_NINTHER_THRESHOLD)
+		return (median_of_three(array, left, mid, last));
+
+	step = (right - left) / 8;
+
+	return (median_of_three(array,
+		median_of_three(array, left, left + step, left + 2 * step),
+		median_of_three(array, mid - step, mid, mid + step),
+		median_of_three(array, last - 2 * step, last - step, last)));
+}
+
+/**
+ * median_of_three - Finds the median of three elements of an array.
+ *
+ * @array: Pointer to the first element of the array.
+ * @a: Index of the first element.
+ * @b: Index of the second element.
+ * @c: Index of the third element.
+ *
+ * Return: The index (a, b or c) of the median value.
+ */
+static size_t median_of_three(int *array, size_t a, size_t b, size_t c)
+{
+	if (array[a] < array[b])
+	{
+		if (array[b] < array[c])
+			return (b);
+		return (array[a] < array[c] ? c : a);
+	}
+
+	if (array[a] < array[c])
+		return (a);
+	return (array[b] < array[c] ? c : b);
+}
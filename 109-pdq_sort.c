@@ -0,0 +1,158 @@
+#include "sort.h"
+
+static void pdq_sort_start(int *array, size_t size, size_t traced);
+static void _pdq_sort(int *array, size_t size, size_t begin, size_t end,
+		      size_t bad_allowed, int leftmost);
+static void break_patterns(int *array, size_t begin, size_t end);
+
+/**
+ * pdq_sort - Sorts an array of integers in ascending order using
+ * Pattern-defeating Quicksort.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the array.
+ *
+ * Description:
+ * pdqsort extends the Hoare quick sort of quick_sort_hoare with:
+ * - branchless block partitioning (BlockQuicksort), see
+ *   pdq_block_partition;
+ * - detection of already partitioned ranges, which are then finished
+ *   with a bounded insertion sort, so sorted runs cost O(n);
+ * - pattern breaking after a badly unbalanced partition, and a
+ *   heap_sort_bottom_up fallback after log2(size) of them;
+ * - a three-way path for inputs with many equal keys: when the pivot
+ *   equals the element preceding the range, every element equal to it
+ *   is skipped in a single pdq_partition_left pass.
+ * The array is traced after every partition.
+ *
+ * Note:
+ * - The input array must be a valid array of integers.
+ */
+void pdq_sort(int *array, size_t size)
+{
+	pdq_sort_start(array, size, size);
+}
+
+/**
+ * pdq_sort_untraced - Sorts an array of integers in ascending order
+ * using Pattern-defeating Quicksort, without tracing.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the array.
+ *
+ * Description:
+ * Same algorithm as pdq_sort, for the sorts that use it on a part of
+ * their array (radix_sort_msd buckets, large small_sort calls): tracing
+ * that part alone would not show the array being sorted.
+ */
+void pdq_sort_untraced(int *array, size_t size)
+{
+	pdq_sort_start(array, size, 0);
+}
+
+/**
+ * pdq_sort_start - Sorts an array with pdqsort, allowing log2(size)
+ * unbalanced partitions.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the array.
+ * @traced: Number of elements traced after every partition, 0 for none.
+ */
+static void pdq_sort_start(int *array, size_t size, size_t traced)
+{
+	size_t bad_allowed = 0, n;
+
+	if (!array || size < 2)
+		return;
+
+	for (n = size; n > 1; n >>= 1)
+		bad_allowed++;
+
+	_pdq_sort(array, traced, 0, size, bad_allowed, 1);
+}
+
+/**
+ * _pdq_sort - Sorts the sub-array [begin, end) with pdqsort.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the whole array, traced after every partition, or 0
+ * not to trace.
+ * @begin: Index of the first element of the sub-array.
+ * @end: Index of the last element + 1 (exclusive) of the sub-array.
+ * @bad_allowed: Unbalanced partitions allowed before heap_sort_bottom_up.
+ * @leftmost: 1 if the sub-array starts the array, 0 if array[begin - 1]
+ * is known to be less than or equal to every element of the sub-array.
+ */
+static void _pdq_sort(int *array, size_t size, size_t begin, size_t end,
+		      size_t bad_allowed, int leftmost)
+{
+	size_t n, pivot;
+	int already_partitioned;
+
+	while ((n = end - begin) >= PDQ_INSERTION_THRESHOLD)
+	{
+		pdq_choose_pivot(array, begin, end);
+		if (!leftmost && !(array[begin - 1] < array[begin]))
+		{
+			begin = pdq_partition_left(array, begin, end) + 1;
+			continue;
+		}
+
+		pivot = pdq_partition_right(array, begin, end,
+					    &already_partitioned);
+		if (size)
+			TRACE_ARRAY(array, size);
+
+		if (pivot - begin < n / 8 || end - pivot - 1 < n / 8)
+		{
+			if (--bad_allowed == 0)
+			{
+				heap_sort_bottom_up(array + begin, n, 0);
+				return;
+			}
+			break_patterns(array, begin, pivot);
+			break_patterns(array, pivot + 1, end);
+		}
+		else if (already_partitioned &&
+			 pdq_partial_insertion_sort(array, begin, pivot) &&
+			 pdq_partial_insertion_sort(array, pivot + 1, end))
+			return;
+
+		_pdq_sort(array, size, begin, pivot, bad_allowed, leftmost);
+		begin = pivot + 1;
+		leftmost = 0;
+	}
+
+	small_sort(array + begin, n);
+}
+
+/**
+ * break_patterns - Shuffles a few elements of a badly split sub-array.
+ *
+ * @array: Pointer to the first element of the array.
+ * @begin: Index of the first element of the sub-array.
+ * @end: Index of the last element + 1 (exclusive) of the sub-array.
+ *
+ * Description:
+ * Swapping elements from the quarter points to the ends changes the
+ * next pivot sample, which defeats the inputs (organ pipes, sawtooth,
+ * median-of-3 killers) that keep producing unbalanced partitions.
+ */
+static void break_patterns(int *array, size_t begin, size_t end)
+{
+	size_t quarter = (end - begin) / 4;
+
+	if (end - begin < PDQ_INSERTION_THRESHOLD)
+		return;
+
+	swap(&array[begin], &array[begin + quarter]);
+	swap(&array[end - 1], &array[end - quarter]);
+
+	if (end - begin > PDQ_NINTHER_THRESHOLD)
+	{
+		swap(&array[begin + 1], &array[begin + quarter + 1]);
+		swap(&array[begin + 2], &array[begin + quarter + 2]);
+		swap(&array[end - 2], &array[end - quarter - 1]);
+		swap(&array[end - 3], &array[end - quarter - 2]);
+	}
+}
@@ -0,0 +1,123 @@
+#include "sort.h"
+
+static size_t min_run_length(size_t size);
+static size_t count_run(int *array, size_t lo, size_t hi);
+
+/**
+ * tim_sort - Sorts an array of integers in ascending order using
+ * the TimSort algorithm.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the array.
+ *
+ * Description:
+ * TimSort is an adaptive, stable merge sort. Instead of splitting the
+ * array down to single elements like merge_sort, it walks the array
+ * once to find the runs that are already ascending (or strictly
+ * descending, which are reversed), extends the short ones to a minimum
+ * length with small_sort (equal ints cannot be told apart, so its
+ * network does not break stability), and merges neighbouring runs
+ * while keeping their lengths balanced. Merges copy only the smaller
+ * run aside and gallop over long stretches won by the same run, so
+ * nearly sorted inputs are sorted in close to O(n). It never traces.
+ *
+ * Note:
+ * - The input array must be a valid array of integers.
+ * - The array is left unsorted if the merge buffer cannot be allocated.
+ */
+void tim_sort(int *array, size_t size)
+{
+	tim_sort_t ts;
+	size_t lo, run, forced, min_run;
+
+	if (!array || size < 2 || count_run(array, 0, size) == size)
+		return;
+
+	ts.array = array;
+	ts.buffer = malloc(sizeof(int) * (size / 2));
+	if (!ts.buffer)
+		return;
+	ts.min_gallop = TIM_SORT_MIN_GALLOP;
+	ts.runs = 0;
+
+	min_run = min_run_length(size);
+	for (lo = 0; lo < size; lo += run)
+	{
+		run = count_run(array, lo, size);
+		if (run < min_run)
+		{
+			forced = size - lo < min_run ? size - lo : min_run;
+			small_sort(array + lo, forced);
+			run = forced;
+		}
+
+		ts.run_base[ts.runs] = lo;
+		ts.run_len[ts.runs++] = run;
+		tim_merge_collapse(&ts);
+	}
+
+	tim_merge_force_collapse(&ts);
+	free(ts.buffer);
+}
+
+/**
+ * min_run_length - Computes the minimum length of a run.
+ *
+ * @size: Size of the array.
+ *
+ * Description:
+ * Returns a length between TIM_SORT_MIN_MERGE / 2 and TIM_SORT_MIN_MERGE
+ * such that size / min_run is a power of two or slightly less, which
+ * keeps the final merges balanced.
+ *
+ * Return: The minimum run length.
+ */
+static size_t min_run_length(size_t size)
+{
+	size_t low_bits = 0;
+
+	while (size >= TIM_SORT_MIN_MERGE)
+	{
+		low_bits |= size & 1;
+		size >>= 1;
+	}
+
+	return (size + low_bits);
+}
+
+/**
+ * count_run - Measures the run starting at `lo` and makes it ascending.
+ *
+ * @array: Pointer to the first element of the array.
+ * @lo: Index of the first element of the run.
+ * @hi: Index of the last element + 1 (exclusive) the run may reach.
+ *
+ * Description:
+ * A run is either non-descending or strictly descending; the strict
+ * comparison keeps equal elements in order when a descending run is
+ * reversed, which preserves stability.
+ *
+ * Return: The length of the run.
+ */
+static size_t count_run(int *array, size_t lo, size_t hi)
+{
+	size_t end = lo + 1, left, right;
+
+	if (end == hi)
+		return (1);
+
+	if (array[end++] < array[lo])
+	{
+		while (end < hi && array[end] < array[end - 1])
+			end++;
+		for (left = lo, right = end - 1; left < right; left++, right--)
+			swap(&array[left], &array[right]);
+	}
+	else
+	{
+		while (end < hi && array[end] >= array[end - 1])
+			end++;
+	}
+
+	return (end - lo);
+}
@@ -0,0 +1,173 @@
+#include "sort.h"
+
+static void sort_base_blocks(const int *src, int *dst, size_t size);
+static void sort8_network(const int *src, int *dst);
+static void merge_pass(const int *src, int *dst, size_t size, size_t width);
+static void merge_runs(const int *src, int *dst, size_t left, size_t mid,
+		       size_t right);
+
+/**
+ * merge_sort_bottom_up - Sorts an array of integers using an iterative,
+ * bottom-up merge sort.
+ *
+ * @array: Pointer to the array of integers to be sorted.
+ * @size: Size of the array (number of elements).
+ * @scratch: Optional caller-owned buffer of at least `size` integers,
+ * or NULL to let the function allocate (and free) one.
+ *
+ * Description:
+ * Blocks of MERGE_BASE_BLOCK elements are sorted with a sorting
+ * network, then merged pairwise in passes of doubling width. Each pass
+ * reads from one buffer and writes to the other, and the roles swap
+ * between passes instead of copying back. The base pass writes to
+ * whichever buffer makes the last pass land in `array`, so no final
+ * copy is needed either. Passing the same `scratch` to every call
+ * avoids a malloc/free per call when sorting many small batches.
+ * It never traces.
+ */
+void merge_sort_bottom_up(int *array, size_t size, int *scratch)
+{
+	int *buffer = scratch, *src, *dst, *tmp;
+	size_t width, passes = 0;
+
+	if (!array || size < 2)
+		return;
+
+	if (!buffer)
+		buffer = malloc(sizeof(int) * size);
+	if (!buffer)
+		return;
+
+	for (width = MERGE_BASE_BLOCK; width < size; width *= 2)
+		passes++;
+
+	src = passes % 2 ? buffer : array;
+	dst = passes % 2 ? array : buffer;
+	sort_base_blocks(array, src, size);
+
+	for (width = MERGE_BASE_BLOCK; width < size; width *= 2)
+	{
+		merge_pass(src, dst, size, width);
+		tmp = src, src = dst, dst = tmp;
+	}
+
+	if (!scratch)
+		free(buffer);
+}
+
+/**
+ * sort_base_blocks - Sorts every block of MERGE_BASE_BLOCK elements.
+ *
+ * @src: Pointer to the unsorted elements.
+ * @dst: Pointer receiving the sorted blocks, may be equal to `src`.
+ * @size: Number of elements.
+ */
+static void sort_base_blocks(const int *src, int *dst, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i + MERGE_BASE_BLOCK <= size; i += MERGE_BASE_BLOCK)
+		sort8_network(src + i, dst + i);
+
+	if (i < size)
+	{
+		if (dst != src)
+			memcpy(dst + i, src + i, (size - i) * sizeof(int));
+		small_sort(dst + i, size - i);
+	}
+}
+
+/**
+ * sort8_network - Sorts 8 integers with an optimal sorting network.
+ *
+ * @src: Pointer to the 8 elements to sort.
+ * @dst: Pointer receiving the 8 sorted elements, may be equal to `src`.
+ *
+ * Description:
+ * The 19 compare-exchanges are branchless min/max pairs on registers,
+ * so the cost does not depend on the input.
+ */
+static void sort8_network(const int *src, int *dst)
+{
+	int a0 = src[0], a1 = src[1], a2 = src[2], a3 = src[3];
+	int a4 = src[4], a5 = src[5], a6 = src[6], a7 = src[7];
+
+	CMPXCHG(a0, a2);
+	CMPXCHG(a1, a3);
+	CMPXCHG(a4, a6);
+	CMPXCHG(a5, a7);
+	CMPXCHG(a0, a4);
+	CMPXCHG(a1, a5);
+	CMPXCHG(a2, a6);
+	CMPXCHG(a3, a7);
+	CMPXCHG(a0, a1);
+	CMPXCHG(a2, a3);
+	CMPXCHG(a4, a5);
+	CMPXCHG(a6, a7);
+	CMPXCHG(a2, a4);
+	CMPXCHG(a3, a5);
+	CMPXCHG(a1, a4);
+	CMPXCHG(a3, a6);
+	CMPXCHG(a1, a2);
+	CMPXCHG(a3, a4);
+	CMPXCHG(a5, a6);
+
+	dst[0] = a0, dst[1] = a1, dst[2] = a2, dst[3] = a3;
+	dst[4] = a4, dst[5] = a5, dst[6] = a6, dst[7] = a7;
+}
+
+/**
+ * merge_pass - Merges every pair of adjacent sorted runs of a width.
+ *
+ * @src: Pointer to the runs to merge.
+ * @dst: Pointer receiving the merged runs.
+ * @size: Number of elements.
+ * @width: Length of the sorted runs in `src`.
+ */
+static void merge_pass(const int *src, int *dst, size_t size, size_t width)
+{
+	size_t left, mid, right;
+
+	for (left = 0; left < size; left += 2 * width)
+	{
+		mid = left + width < size ? left + width : size;
+		right = mid + width < size ? mid + width : size;
+		merge_runs(src, dst, left, mid, right);
+	}
+}
+
+/**
+ * merge_runs - Merges two sorted runs of one buffer into another buffer.
+ *
+ * @src: Pointer to the buffer holding the runs.
+ * @dst: Pointer to the buffer receiving the merged run.
+ * @left: Index of the first element of the first run.
+ * @mid: Index of the first element of the second run.
+ * @right: Index of the last element + 1 (exclusive) of the second run.
+ *
+ * Description:
+ * Runs that are already in order are copied as a block. Ties are taken
+ * from the first run, which keeps the sort stable.
+ */
+static void merge_runs(const int *src, int *dst, size_t left, size_t mid,
+		       size_t right)
+{
+	size_t low = left, high = mid, i = left;
+
+	if (mid == right || src[mid - 1] <= src[mid])
+	{
+		memcpy(dst + left, src + left, (right - left) * sizeof(int));
+		return;
+	}
+
+	while (low < mid && high < right)
+	{
+		if (src[high] < src[low])
+			dst[i++] = src[high++];
+		else
+			dst[i++] = src[low++];
+	}
+
+	memcpy(dst + i, src + low, (mid - low) * sizeof(int));
+	memcpy(dst + i + (mid - low), src + high, (right - high) * sizeof(int));
+}
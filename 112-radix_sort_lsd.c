@@ -0,0 +1,95 @@
+#include "sort.h"
+
+static void radix_scatter(const int *src, int *dst, size_t size,
+			  size_t pass, size_t *counts);
+
+/**
+ * radix_sort_lsd - Sorts an array of integers using a least significant
+ * digit radix sort on bytes.
+ *
+ * @array: array Pointer to the array to be sorted.
+ * @size: size Number of elements in the array.
+ *
+ * Description:
+ * Each 32-bit key is read as 4 digits of 8 bits, after flipping its
+ * sign bit so that negative values order before positive ones. The 4
+ * digit histograms are computed in a single read pass, a pass whose
+ * digit is the same for every key is skipped, and the remaining passes
+ * scatter back and forth between the array and one buffer. The sort is
+ * stable, and the array is left untouched if the buffer cannot be
+ * allocated. It never traces.
+ */
+void radix_sort_lsd(int *array, size_t size)
+{
+	size_t counts[RADIX_PASSES][RADIX_BUCKETS], pass;
+	int *buffer, *src = array, *dst, *tmp;
+
+	if (!array || size < 2)
+		return;
+
+	buffer = malloc(sizeof(int) * size);
+	if (!buffer)
+		return;
+	dst = buffer;
+
+	radix_histograms(array, size, counts);
+	for (pass = 0; pass < RADIX_PASSES; pass++)
+	{
+		if (counts[pass][RADIX_DIGIT(array[0], pass)] == size)
+			continue;
+		radix_scatter(src, dst, size, pass, counts[pass]);
+		tmp = src, src = dst, dst = tmp;
+	}
+
+	if (src != array)
+		memcpy(array, src, sizeof(int) * size);
+	free(buffer);
+}
+
+/**
+ * radix_histograms - Counts the occurrences of every digit of every pass.
+ *
+ * @array: array Pointer to the keys.
+ * @size: size Number of keys.
+ * @counts: Receives, for each pass, the number of keys per digit.
+ */
+void radix_histograms(const int *array, size_t size,
+		      size_t counts[RADIX_PASSES][RADIX_BUCKETS])
+{
+	size_t i;
+	unsigned int key;
+
+	memset(counts, 0, sizeof(size_t) * RADIX_PASSES * RADIX_BUCKETS);
+	for (i = 0; i < size; i++)
+	{
+		key = RADIX_KEY(array[i]);
+		counts[0][key & 0xff]++;
+		counts[1][(key >> 8) & 0xff]++;
+		counts[2][(key >> 16) & 0xff]++;
+		counts[3][key >> 24]++;
+	}
+}
+
+/**
+ * radix_scatter - Distributes the keys by one digit, keeping their order.
+ *
+ * @src: Pointer to the keys to distribute.
+ * @dst: Pointer receiving the distributed keys.
+ * @size: size Number of keys.
+ * @pass: Index of the digit, 0 being the least significant byte.
+ * @counts: Number of keys per digit for this pass.
+ */
+static void radix_scatter(const int *src, int *dst, size_t size,
+			  size_t pass, size_t *counts)
+{
+	size_t offsets[RADIX_BUCKETS], i, total = 0;
+
+	for (i = 0; i < RADIX_BUCKETS; i++)
+	{
+		offsets[i] = total;
+		total += counts[i];
+	}
+
+	for (i = 0; i < size; i++)
+		dst[offsets[RADIX_DIGIT(src[i], pass)]++] = src[i];
+}
@@ -0,0 +1,106 @@
+#include "sort.h"
+
+static void _radix_sort_msd(int *array, size_t size, size_t pass);
+static void msd_permute(int *array, size_t pass, size_t *heads,
+			const size_t *tails);
+
+/**
+ * radix_sort_msd - Sorts an array of integers in place using a most
+ * significant digit radix sort on bytes (American flag sort).
+ *
+ * @array: array Pointer to the array to be sorted.
+ * @size: size Number of elements in the array.
+ *
+ * Description:
+ * Starting with the most significant byte (sign bit flipped, like
+ * radix_sort_lsd), the keys are counted per digit and then permuted in
+ * place into their buckets by following swap cycles, so no buffer is
+ * needed and the peak memory stays at the array itself. Each bucket is
+ * then sorted recursively on the next byte; buckets smaller than
+ * RADIX_MSD_THRESHOLD are handed to pdq_sort_untraced instead. The sort
+ * is not stable and never traces.
+ */
+void radix_sort_msd(int *array, size_t size)
+{
+	if (!array || size < 2)
+		return;
+
+	_radix_sort_msd(array, size, RADIX_PASSES - 1);
+}
+
+/**
+ * _radix_sort_msd - Sorts a bucket on one digit, then each sub-bucket
+ * on the following digits.
+ *
+ * @array: array Pointer to the first element of the bucket.
+ * @size: size Number of elements in the bucket.
+ * @pass: Index of the digit to sort on, 3 being the most significant.
+ */
+static void _radix_sort_msd(int *array, size_t size, size_t pass)
+{
+	size_t counts[RADIX_BUCKETS] = {0}, heads[RADIX_BUCKETS];
+	size_t tails[RADIX_BUCKETS], i, total = 0;
+
+	if (size < RADIX_MSD_THRESHOLD)
+	{
+		pdq_sort_untraced(array, size);
+		return;
+	}
+
+	for (i = 0; i < size; i++)
+		counts[RADIX_DIGIT(array[i], pass)]++;
+
+	for (i = 0; i < RADIX_BUCKETS; i++)
+	{
+		heads[i] = total;
+		total += counts[i];
+		tails[i] = total;
+	}
+
+	if (counts[RADIX_DIGIT(array[0], pass)] != size)
+		msd_permute(array, pass, heads, tails);
+
+	for (i = 0; pass > 0 && i < RADIX_BUCKETS; i++)
+	{
+		if (counts[i] > 1)
+			_radix_sort_msd(array + tails[i] - counts[i], counts[i],
+					pass - 1);
+	}
+}
+
+/**
+ * msd_permute - Moves every element into the bucket of its digit.
+ *
+ * @array: array Pointer to the first element of the bucket.
+ * @pass: Index of the digit the buckets are based on.
+ * @heads: Index of the first unplaced slot of each bucket, updated.
+ * @tails: Index of the end (exclusive) of each bucket.
+ *
+ * Description:
+ * The element in the first unplaced slot of a bucket is swapped to
+ * the first unplaced slot of its own bucket until an element that
+ * belongs here comes back, so every element moves exactly once.
+ */
+static void msd_permute(int *array, size_t pass, size_t *heads,
+			const size_t *tails)
+{
+	size_t bucket, digit;
+	int value, tmp;
+
+	for (bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+	{
+		while (heads[bucket] < tails[bucket])
+		{
+			value = array[heads[bucket]];
+			digit = RADIX_DIGIT(value, pass);
+			while (digit != bucket)
+			{
+				tmp = array[heads[digit]];
+				array[heads[digit]++] = value;
+				value = tmp;
+				digit = RADIX_DIGIT(value, pass);
+			}
+			array[heads[bucket]++] = value;
+		}
+	}
+}
@@ -0,0 +1,185 @@
+#include "sort.h"
+
+static void radix_parallel_passes(radix_chunk_t *chunks, size_t threads,
+				  int *array, int *buffer, size_t size);
+static void radix_chunk_offsets(radix_chunk_t *chunks, size_t threads,
+				size_t pass);
+static void *radix_count_chunk(void *chunk);
+static void *radix_scatter_chunk(void *chunk);
+
+/**
+ * radix_sort_parallel - Sorts an array of integers with a multithreaded
+ * byte-wise LSD radix sort.
+ *
+ * @array: array Pointer to the array to be sorted.
+ * @size: size Number of elements in the array.
+ * @scratch: Optional caller-owned buffer of at least `size` integers,
+ * or NULL to let the function allocate (and free) one.
+ * @threads: Number of worker threads, 0 for one per online processor.
+ *
+ * Description:
+ * The array is split into one contiguous chunk per thread. For every
+ * pass each thread counts the digits of its own chunk, the global
+ * offsets are computed digit by digit and thread by thread, and each
+ * thread scatters its chunk into disjoint slots of the output. Since
+ * chunk i always lands before chunk i + 1 inside a bucket, the sort is
+ * stable and the result is exactly that of radix_sort_lsd. Small arrays,
+ * or chunks that cannot be allocated, use a single chunk on the calling
+ * thread, so with a `scratch` buffer the array is always sorted; without
+ * one it is left untouched if the buffer cannot be allocated. It never
+ * traces.
+ */
+void radix_sort_parallel(int *array, size_t size, int *scratch,
+			 size_t threads)
+{
+	radix_chunk_t single, *chunks = NULL;
+	int *buffer = scratch;
+	size_t i;
+
+	if (!array || size < 2)
+		return;
+
+	threads = sort_thread_count(threads);
+	threads = threads < SORT_MAX_THREADS ? threads : SORT_MAX_THREADS;
+	threads = size < RADIX_PARALLEL_THRESHOLD ? 1 : threads;
+	if (!buffer)
+		buffer = malloc(sizeof(int) * size);
+	if (threads > 1)
+		chunks = malloc(sizeof(*chunks) * threads);
+	if (!chunks)
+		chunks = &single, threads = 1;
+
+	if (buffer)
+	{
+		for (i = 0; i < threads; i++)
+		{
+			chunks[i].begin = size / threads * i;
+			chunks[i].end = i + 1 < threads ?
+				size / threads * (i + 1) : size;
+		}
+		radix_parallel_passes(chunks, threads, array, buffer, size);
+	}
+
+	if (chunks != &single)
+		free(chunks);
+	if (!scratch)
+		free(buffer);
+}
+
+/**
+ * radix_parallel_passes - Runs the count and scatter phases of every
+ * pass that is not skipped.
+ *
+ * @chunks: Pointer to the chunk of each thread.
+ * @threads: Number of threads (and chunks).
+ * @array: array Pointer to the array to be sorted.
+ * @buffer: Pointer to a buffer of `size` integers.
+ * @size: size Number of elements in the array.
+ */
+static void radix_parallel_passes(radix_chunk_t *chunks, size_t threads,
+				  int *array, int *buffer, size_t size)
+{
+	size_t pass, i, first = 1;
+	int *src = array, *dst = buffer, *tmp;
+
+	for (i = 0; i < threads; i++)
+		chunks[i].src = array, chunks[i].pass = RADIX_PASSES;
+	sort_run_parallel(radix_count_chunk, chunks, sizeof(*chunks), threads);
+
+	for (pass = 0; pass < RADIX_PASSES; pass++)
+	{
+		for (i = 0; i < threads && chunks[i].counts[pass]
+			     [RADIX_DIGIT(array[0], pass)] ==
+			     chunks[i].end - chunks[i].begin; i++)
+			;
+		if (i == threads)
+			continue;
+
+		for (i = 0; i < threads; i++)
+			chunks[i].src = src, chunks[i].dst = dst,
+				chunks[i].pass = pass;
+		/* A single chunk spans the array: its counts never change */
+		if (!first && threads > 1)
+			sort_run_parallel(radix_count_chunk, chunks,
+					  sizeof(*chunks), threads);
+		radix_chunk_offsets(chunks, threads, pass);
+		sort_run_parallel(radix_scatter_chunk, chunks,
+				  sizeof(*chunks), threads);
+		tmp = src, src = dst, dst = tmp, first = 0;
+	}
+
+	if (src != array)
+		memcpy(array, src, sizeof(int) * size);
+}
+
+/**
+ * radix_chunk_offsets - Computes where each thread writes each digit.
+ *
+ * @chunks: Pointer to the chunk of each thread.
+ * @threads: Number of threads (and chunks).
+ * @pass: Index of the digit of the pass.
+ *
+ * Description:
+ * Buckets are laid out digit by digit, and inside a bucket the chunks
+ * are laid out in thread order, which is what keeps the sort stable.
+ */
+static void radix_chunk_offsets(radix_chunk_t *chunks, size_t threads,
+				size_t pass)
+{
+	size_t digit, i, total = 0;
+
+	for (digit = 0; digit < RADIX_BUCKETS; digit++)
+	{
+		for (i = 0; i < threads; i++)
+		{
+			chunks[i].offsets[digit] = total;
+			total += chunks[i].counts[pass][digit];
+		}
+	}
+}
+
+/**
+ * radix_count_chunk - Thread routine counting the digits of a chunk.
+ *
+ * @chunk: Pointer to the radix_chunk_t of the thread. When its pass is
+ * RADIX_PASSES every digit is counted, otherwise only that pass.
+ *
+ * Return: Always NULL.
+ */
+static void *radix_count_chunk(void *chunk)
+{
+	radix_chunk_t *c = chunk;
+	size_t i;
+
+	if (c->pass == RADIX_PASSES)
+	{
+		radix_histograms(c->src + c->begin, c->end - c->begin,
+				 c->counts);
+		return (NULL);
+	}
+
+	memset(c->counts[c->pass], 0, sizeof(c->counts[c->pass]));
+	for (i = c->begin; i < c->end; i++)
+		c->counts[c->pass][RADIX_DIGIT(c->src[i], c->pass)]++;
+
+	return (NULL);
+}
+
+/**
+ * radix_scatter_chunk - Thread routine scattering a chunk by one digit.
+ *
+ * @chunk: Pointer to the radix_chunk_t of the thread.
+ *
+ * Return: Always NULL.
+ */
+static void *radix_scatter_chunk(void *chunk)
+{
+	radix_chunk_t *c = chunk;
+	size_t i;
+
+	for (i = c->begin; i < c->end; i++)
+		c->dst[c->offsets[RADIX_DIGIT(c->src[i], c->pass)]++] =
+			c->src[i];
+
+	return (NULL);
+}
@@ -0,0 +1,82 @@
+#include "sort.h"
+
+static void get_min_max(const int *array, size_t size, int *min, int *max);
+
+/**
+ * counting_sort_range - Sorts an array of integers with a counting sort
+ * sized to the actual range of its values.
+ *
+ * This function finds the minimum and maximum values in a single pass
+ * and allocates one counter per value of [min, max], so the table never
+ * starts from 0 and a narrow range of large values stays cheap. If the
+ * range exceeds `range_factor` times the number of elements, counting
+ * would cost more than it saves (one outlier such as INT_MAX would
+ * otherwise ask for gigabytes) and the array is sorted with
+ * radix_sort_lsd instead. Since the keys are plain integers, the
+ * output is rewritten directly from the counters, without the stable
+ * scatter pass or a second array. It never traces.
+ *
+ * @array: array Pointer to the array of integers.
+ * @size: size Size of the array.
+ * @range_factor: Largest range allowed per element before falling back
+ * to radix_sort_lsd, 0 for COUNTING_SORT_RANGE_FACTOR.
+ */
+void counting_sort_range(int *array, size_t size, size_t range_factor)
+{
+	size_t *counter, range, i, value;
+	int max, min;
+
+	if (!array || size < 2)
+		return;
+
+	if (!range_factor)
+		range_factor = COUNTING_SORT_RANGE_FACTOR;
+
+	get_min_max(array, size, &min, &max);
+	range = (size_t)((unsigned int)max - (unsigned int)min) + 1;
+	if (range / range_factor > size)
+	{
+		radix_sort_lsd(array, size);
+		return;
+	}
+
+	counter = calloc(range, sizeof(*counter));
+	if (!counter)
+	{
+		radix_sort_lsd(array, size);
+		return;
+	}
+
+	for (i = 0; i < size; i++)
+		counter[(unsigned int)array[i] - (unsigned int)min]++;
+
+	for (value = 0, i = 0; value < range; value++)
+		while (counter[value]--)
+			array[i++] = (int)((unsigned int)min + value);
+
+	free(counter);
+}
+
+/**
+ * get_min_max - Finds the minimum and maximum values of an array
+ * in a single pass.
+ *
+ * @array: array Pointer to the array of integers.
+ * @size: size Size of the array, at least 1.
+ * @min: Receives the minimum value.
+ * @max: Receives the maximum value.
+ */
+static void get_min_max(const int *array, size_t size, int *min, int *max)
+{
+	size_t i;
+	int low = array[0], high = array[0];
+
+	for (i = 1; i < size; i++)
+	{
+		low = array[i] < low ? array[i] : low;
+		high = array[i] > high ? array[i] : high;
+	}
+
+	*min = low;
+	*max = high;
+}
@@ -0,0 +1,176 @@
+#include "sort.h"
+
+static size_t sift_binary(int *array, size_t hole, size_t size,
+			  size_t arity);
+static size_t sift_quaternary(int *array, size_t hole, size_t size,
+			      size_t arity);
+static size_t sift_d_ary(int *array, size_t hole, size_t size,
+			 size_t arity);
+static void sift_up(int *array, size_t root, size_t hole, size_t arity,
+		    int value);
+
+/**
+ * heap_sort_bottom_up - Sorts an array of integers in ascending order
+ * using a bottom-up heap sort on a d-ary heap.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array.
+ * @arity: Number of children per node, 0 to pick one from the size.
+ *
+ * Description:
+ * The heap is built and drained with Floyd's bottom-up sift: the hole
+ * left by the root walks down to a leaf, always towards the larger
+ * child, then the displaced value climbs back up from that leaf. The
+ * value almost always belongs near the bottom, so this costs one
+ * comparison per level instead of two, and elements are moved into the
+ * hole instead of being swapped. A binary heap is the fastest while the
+ * array fits in cache; past HEAP_SORT_D_ARY_THRESHOLD elements a 4-ary
+ * heap, whose children share a cache line, halves the cache misses.
+ * Unlike heap_sort, it never traces.
+ */
+void heap_sort_bottom_up(int *array, size_t size, size_t arity)
+{
+	size_t (*sift)(int *, size_t, size_t, size_t);
+	size_t i, hole;
+	int value;
+
+	if (!array || size < 2)
+		return;
+
+	if (arity < 2)
+		arity = size > HEAP_SORT_D_ARY_THRESHOLD ? 4 : 2;
+	sift = arity == 2 ? sift_binary :
+		arity == 4 ? sift_quaternary : sift_d_ary;
+
+	for (i = (size - 2) / arity + 1; i-- > 0;)
+	{
+		value = array[i];
+		hole = sift(array, i, size, arity);
+		sift_up(array, i, hole, arity, value);
+	}
+
+	for (i = size - 1; i > 0; i--)
+	{
+		value = array[i];
+		array[i] = array[0];
+		hole = sift(array, 0, i, arity);
+		sift_up(array, 0, hole, arity, value);
+	}
+}
+
+/**
+ * sift_binary - Walks a hole down a binary heap to a leaf, moving the
+ * larger child up at each level.
+ *
+ * @array: Pointer to the heap.
+ * @hole: Index of the hole.
+ * @size: Number of elements in the heap.
+ * @arity: Unused, always 2.
+ *
+ * Return: Index of the leaf the hole ended on.
+ */
+static size_t sift_binary(int *array, size_t hole, size_t size,
+			  size_t arity)
+{
+	size_t child;
+
+	(void)arity;
+	while ((child = hole * 2 + 1) + 1 < size)
+	{
+		/* Branchless: the comparison is a coin flip on random input */
+		child += array[child + 1] > array[child];
+		array[hole] = array[child];
+		hole = child;
+	}
+	if (child < size)
+	{
+		array[hole] = array[child];
+		hole = child;
+	}
+
+	return (hole);
+}
+
+/**
+ * sift_quaternary - Walks a hole down a 4-ary heap to a leaf, moving the
+ * largest child up at each level.
+ *
+ * @array: Pointer to the heap.
+ * @hole: Index of the hole.
+ * @size: Number of elements in the heap.
+ * @arity: Unused, always 4.
+ *
+ * Return: Index of the leaf the hole ended on.
+ */
+static size_t sift_quaternary(int *array, size_t hole, size_t size,
+			      size_t arity)
+{
+	size_t child, left, right;
+
+	while ((child = hole * 4 + 1) + 3 < size)
+	{
+		/* Two independent pairs, then their winners */
+		left = child + (array[child + 1] > array[child]);
+		right = child + 2 + (array[child + 3] > array[child + 2]);
+		child = array[right] > array[left] ? right : left;
+		array[hole] = array[child];
+		hole = child;
+	}
+	if (child < size)
+		hole = sift_d_ary(array, hole, size, arity);
+
+	return (hole);
+}
+
+/**
+ * sift_d_ary - Walks a hole down a d-ary heap to a leaf, moving the
+ * largest child up at each level.
+ *
+ * @array: Pointer to the heap.
+ * @hole: Index of the hole.
+ * @size: Number of elements in the heap.
+ * @arity: Number of children per node.
+ *
+ * Return: Index of the leaf the hole ended on.
+ */
+static size_t sift_d_ary(int *array, size_t hole, size_t size,
+			 size_t arity)
+{
+	size_t child, best, last;
+
+	while ((child = hole * arity + 1) < size)
+	{
+		last = child + arity < size ? child + arity : size;
+		for (best = child++; child < last; child++)
+			best = array[child] > array[best] ? child : best;
+		array[hole] = array[best];
+		hole = best;
+	}
+
+	return (hole);
+}
+
+/**
+ * sift_up - Moves a value up from a leaf hole to its place in a sub-heap.
+ *
+ * @array: Pointer to the heap.
+ * @root: Index of the root of the sub-heap.
+ * @hole: Index of the hole left by a downward sift.
+ * @arity: Number of children per node.
+ * @value: Value to store in the sub-heap.
+ */
+static void sift_up(int *array, size_t root, size_t hole, size_t arity,
+		    int value)
+{
+	size_t parent;
+
+	while (hole > root)
+	{
+		parent = (hole - 1) / arity;
+		if (array[parent] >= value)
+			break;
+		array[hole] = array[parent];
+		hole = parent;
+	}
+	array[hole] = value;
+}
@@ -0,0 +1,188 @@
+#include "sort.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BITONIC_LANES 8
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define BITONIC_LANES 4
+#else
+#define BITONIC_LANES 1
+#endif
+
+static void bitonic_flip(int *array, size_t size, size_t block);
+static void cmpxchg_lanes(int *array, size_t size, size_t low, size_t high,
+			  size_t count);
+static void cmpxchg_lanes_reversed(int *array, size_t size, size_t low,
+				   size_t high, size_t count);
+
+/**
+ * bitonic_sort_network - Sorts an array of integers of any size in
+ * ascending order with an iterative bitonic sorting network.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array, not necessarily a power of 2.
+ *
+ * Description:
+ * The network is the one of a power of 2 size padded with +infinity,
+ * written so that every comparator puts the minimum at the lower index:
+ * each block of 2^k elements is first merged with a "flip" comparing
+ * i with its mirror in the block, then with half-cleaners comparing
+ * i with i + distance. A comparator whose upper element falls past
+ * `size` would compare with the padding and leave the element in place,
+ * so it is skipped and no padding is stored. Comparators are branchless,
+ * and with SSE4.1 or AVX2 enabled they run 4 or 8 at a time once the
+ * distance spans a vector. It never traces.
+ */
+void bitonic_sort_network(int *array, size_t size)
+{
+	size_t block, distance;
+
+	if (!array || size < 2)
+		return;
+
+	for (block = 2; block / 2 < size; block *= 2)
+	{
+		bitonic_flip(array, size, block);
+		for (distance = block / 4; distance > 0; distance /= 2)
+			bitonic_half_clean(array, size, distance);
+	}
+}
+
+/**
+ * bitonic_flip - Compares every element of each block with its mirror,
+ * merging the two sorted halves of the block into two bitonic ones.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array.
+ * @block: Size of the blocks, a power of 2.
+ */
+static void bitonic_flip(int *array, size_t size, size_t block)
+{
+	size_t begin, i, half = block / 2, count;
+
+	for (begin = 0; begin + half < size; begin += block)
+		for (i = 0; i < half; i += count)
+		{
+			count = half - i < BITONIC_LANES ?
+				half - i : BITONIC_LANES;
+			cmpxchg_lanes_reversed(array, size, begin + i,
+					       begin + block - 1 - i, count);
+		}
+}
+
+/**
+ * bitonic_half_clean - Compares every element with the one `distance`
+ * further, within blocks of 2 * distance elements.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array; pairs past it are skipped.
+ * @distance: Distance between compared elements, a power of 2.
+ */
+void bitonic_half_clean(int *array, size_t size, size_t distance)
+{
+	size_t begin, i, count;
+
+	for (begin = 0; begin + distance < size; begin += 2 * distance)
+		for (i = 0; i < distance; i += count)
+		{
+			count = distance - i < BITONIC_LANES ?
+				distance - i : BITONIC_LANES;
+			cmpxchg_lanes(array, size, begin + i,
+				      begin + distance + i, count);
+		}
+}
+
+/**
+ * cmpxchg_lanes - Compare-exchanges array[low + i] with array[high + i]
+ * for i < count, at once when a full vector is in bounds.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array; pairs whose upper index is past it are
+ * skipped.
+ * @low: Index of the first element receiving a minimum.
+ * @high: Index of the first element receiving a maximum.
+ * @count: Number of pairs, at most BITONIC_LANES.
+ */
+static void cmpxchg_lanes(int *array, size_t size, size_t low, size_t high,
+			  size_t count)
+{
+	size_t i;
+
+#if BITONIC_LANES == 8
+	if (count == 8 && high + 8 <= size)
+	{
+		__m256i a = _mm256_loadu_si256((__m256i *)(array + low));
+		__m256i b = _mm256_loadu_si256((__m256i *)(array + high));
+
+		_mm256_storeu_si256((__m256i *)(array + low),
+				    _mm256_min_epi32(a, b));
+		_mm256_storeu_si256((__m256i *)(array + high),
+				    _mm256_max_epi32(a, b));
+		return;
+	}
+#elif BITONIC_LANES == 4
+	if (count == 4 && high + 4 <= size)
+	{
+		__m128i a = _mm_loadu_si128((__m128i *)(array + low));
+		__m128i b = _mm_loadu_si128((__m128i *)(array + high));
+
+		_mm_storeu_si128((__m128i *)(array + low), _mm_min_epi32(a, b));
+		_mm_storeu_si128((__m128i *)(array + high),
+				 _mm_max_epi32(a, b));
+		return;
+	}
+#endif
+	for (i = 0; i < count && high + i < size; i++)
+		CMPXCHG(array[low + i], array[high + i]);
+}
+
+/**
+ * cmpxchg_lanes_reversed - Compare-exchanges array[low + i] with
+ * array[high - i] for i < count, at once when a full vector is in bounds.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array; pairs whose upper index is past it are
+ * skipped.
+ * @low: Index of the first element receiving a minimum.
+ * @high: Index of the last element receiving a maximum.
+ * @count: Number of pairs, at most BITONIC_LANES.
+ */
+static void cmpxchg_lanes_reversed(int *array, size_t size, size_t low,
+				   size_t high, size_t count)
+{
+	size_t i;
+
+#if BITONIC_LANES == 8
+	if (count == 8 && high < size)
+	{
+		__m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+		__m256i a = _mm256_loadu_si256((__m256i *)(array + low));
+		__m256i b = _mm256_loadu_si256((__m256i *)(array + high - 7));
+
+		b = _mm256_permutevar8x32_epi32(b, reverse);
+		_mm256_storeu_si256((__m256i *)(array + low),
+				    _mm256_min_epi32(a, b));
+		b = _mm256_max_epi32(a, b);
+		b = _mm256_permutevar8x32_epi32(b, reverse);
+		_mm256_storeu_si256((__m256i *)(array + high - 7), b);
+		return;
+	}
+#elif BITONIC_LANES == 4
+	if (count == 4 && high < size)
+	{
+		__m128i a = _mm_loadu_si128((__m128i *)(array + low));
+		__m128i b = _mm_loadu_si128((__m128i *)(array + high - 3));
+
+		b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 1, 2, 3));
+		_mm_storeu_si128((__m128i *)(array + low), _mm_min_epi32(a, b));
+		b = _mm_max_epi32(a, b);
+		b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 1, 2, 3));
+		_mm_storeu_si128((__m128i *)(array + high - 3), b);
+		return;
+	}
+#endif
+	for (i = 0; i < count; i++)
+		if (high - i < size)
+			CMPXCHG(array[low + i], array[high - i]);
+}
@@ -0,0 +1,179 @@
+#include "sort.h"
+
+static void bitonic_sort_step(void *step);
+static void bitonic_clean_step(void *step);
+static void bitonic_compare_step(void *step);
+static void bitonic_fork(bitonic_task_t *halves, void (*routine)(void *));
+
+/**
+ * bitonic_sort_parallel - Sorts an array of integers of any size with a
+ * bitonic network spread over a thread pool.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array.
+ * @threads: Number of threads, 0 for one per online processor.
+ * @grain: Size under which a step runs on a single thread, 0 for
+ * BITONIC_PARALLEL_GRAIN.
+ *
+ * Description:
+ * This is the network of bitonic_sort_network written recursively, as
+ * in bitonic_sort: both halves are sorted, their mirrored elements are
+ * compared, then both halves are cleaned. The two halves of a sort or
+ * clean step are independent and so are the pairs of a comparator
+ * step, so each is forked on a sort_pool_t until it is no larger than
+ * `grain`; below that, the iterative (and vectorized) kernels of
+ * bitonic_sort_network finish the range. The result does not depend on
+ * the number of threads. It never traces.
+ */
+void bitonic_sort_parallel(int *array, size_t size, size_t threads,
+			   size_t grain)
+{
+	sort_pool_t *pool;
+	bitonic_task_t root;
+
+	if (!array || size < 2)
+		return;
+
+	threads = sort_thread_count(threads);
+	root.grain = grain ? grain : BITONIC_PARALLEL_GRAIN;
+	pool = threads > 1 && size > root.grain ? malloc(sizeof(*pool)) : NULL;
+	if (!pool)
+	{
+		bitonic_sort_network(array, size);
+		return;
+	}
+
+	sort_pool_init(pool, threads);
+	root.pool = pool;
+	root.array = array;
+	root.size = size;
+	bitonic_sort_step(&root);
+	sort_pool_destroy(pool);
+	free(pool);
+}
+
+/**
+ * bitonic_sort_step - Sorts the range of a step.
+ *
+ * @step: Pointer to the bitonic_task_t of the range.
+ *
+ * Description:
+ * The range is the head of a block of 2 * half elements padded with
+ * +infinity: its first half is full and its second half has
+ * `size - half` elements.
+ */
+static void bitonic_sort_step(void *step)
+{
+	bitonic_task_t *self = step, halves[2];
+	size_t half = 1;
+
+	if (self->size <= self->grain)
+	{
+		bitonic_sort_network(self->array, self->size);
+		return;
+	}
+
+	while (half * 2 < self->size)
+		half *= 2;
+
+	halves[0] = *self;
+	halves[0].size = half;
+	halves[1] = *self;
+	halves[1].array += half;
+	halves[1].size -= half;
+	bitonic_fork(halves, bitonic_sort_step);
+
+	halves[0] = *self;
+	halves[0].span = half * 2;
+	halves[0].first = half * 2 - self->size;
+	halves[0].last = half;
+	halves[0].flip = 1;
+	bitonic_compare_step(&halves[0]);
+
+	halves[0].size = half;
+	halves[0].span = half / 2;
+	halves[1].span = half / 2;
+	bitonic_fork(halves, bitonic_clean_step);
+}
+
+/**
+ * bitonic_clean_step - Runs every half-cleaner from a distance down to 1
+ * on the range of a step.
+ *
+ * @step: Pointer to the bitonic_task_t of the range, whose `size` is at
+ * most 2 * `span`.
+ */
+static void bitonic_clean_step(void *step)
+{
+	bitonic_task_t *self = step, halves[2];
+	size_t distance;
+
+	if (self->size <= self->grain)
+	{
+		for (distance = self->span; distance > 0; distance /= 2)
+			bitonic_half_clean(self->array, self->size, distance);
+		return;
+	}
+
+	/* The second half is all padding: nothing to compare */
+	for (; self->size <= self->span; self->span /= 2)
+		;
+
+	halves[0] = *self;
+	halves[0].first = 0;
+	halves[0].last = self->size - self->span;
+	halves[0].flip = 0;
+	bitonic_compare_step(&halves[0]);
+
+	halves[0].size = self->span;
+	halves[0].span = self->span / 2;
+	halves[1] = halves[0];
+	halves[1].array += self->span;
+	halves[1].size = self->size - self->span;
+	bitonic_fork(halves, bitonic_clean_step);
+}
+
+/**
+ * bitonic_compare_step - Runs the comparators of a step, either
+ * array[i] against array[span - 1 - i] (flip) or array[i] against
+ * array[i + span], for i from `first` to `last`.
+ *
+ * @step: Pointer to the bitonic_task_t of the comparators.
+ */
+static void bitonic_compare_step(void *step)
+{
+	bitonic_task_t *self = step, halves[2];
+	int *array = self->array;
+	size_t i;
+
+	if (self->last - self->first > self->grain)
+	{
+		halves[0] = *self;
+		halves[0].last = self->first + (self->last - self->first) / 2;
+		halves[1] = *self;
+		halves[1].first = halves[0].last;
+		bitonic_fork(halves, bitonic_compare_step);
+		return;
+	}
+
+	if (self->flip)
+		for (i = self->first; i < self->last; i++)
+			CMPXCHG(array[i], array[self->span - 1 - i]);
+	else
+		for (i = self->first; i < self->last; i++)
+			CMPXCHG(array[i], array[i + self->span]);
+}
+
+/**
+ * bitonic_fork - Runs two independent steps, the first one on any thread
+ * of the pool and the second one on the calling thread.
+ *
+ * @halves: Pointer to the two steps.
+ * @routine: Routine running a step.
+ */
+static void bitonic_fork(bitonic_task_t *halves, void (*routine)(void *))
+{
+	sort_pool_spawn(halves[0].pool, &halves[0].task, routine, &halves[0]);
+	routine(&halves[1]);
+	sort_pool_join(halves[0].pool, &halves[0].task);
+}
@@ -0,0 +1,226 @@
+#include <limits.h>
+#include "sort.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#define SMALL_SORT_NETWORK_MAX 64
+
+static __m256i register_step(__m256i v, __m256i partner, __m256i upper);
+static __m256i sort8_register(__m256i v);
+static __m256i clean8_register(__m256i v);
+#else
+#define SMALL_SORT_NETWORK_MAX 16
+#endif
+static void small_sort_network(int *buffer, size_t size);
+
+/**
+ * small_sort - Sorts a small array of integers with a branchless
+ * sorting network.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array, at most SMALL_SORT_MAX; larger arrays are
+ * handed to pdq_sort_untraced.
+ *
+ * Description:
+ * The elements are copied to a buffer padded with INT_MAX up to the
+ * next of 8, 16, 32 or 64 elements, and the bitonic network of that
+ * fixed size sorts the buffer. Each size has its own copy of the
+ * network, fully unrolled by the compiler, so no comparison depends on
+ * the data and the cost of a call is the same for every input. With
+ * AVX2 the buffer stays in 1 to 8 registers for the whole network.
+ * Without it, scalar networks only beat insertion_sort up to 16
+ * elements, so larger arrays use insertion_sort instead. It is the leaf
+ * sort of introsort, pdq_sort and merge_sort_bottom_up, and never
+ * traces.
+ */
+void small_sort(int *array, size_t size)
+{
+	int buffer[SMALL_SORT_MAX];
+	size_t width = 8, i;
+
+	if (!array || size < 2)
+		return;
+
+	if (size > SMALL_SORT_NETWORK_MAX)
+	{
+		if (size <= SMALL_SORT_MAX)
+			insertion_sort(array, size);
+		else
+			pdq_sort_untraced(array, size);
+		return;
+	}
+
+	while (width < size)
+		width *= 2;
+	memcpy(buffer, array, size * sizeof(*array));
+	for (i = size; i < width; i++)
+		buffer[i] = INT_MAX;
+
+	/* Literal sizes: one unrolled network per size */
+	if (width == 8)
+		small_sort_network(buffer, 8);
+	else if (width == 16)
+		small_sort_network(buffer, 16);
+	else if (width == 32)
+		small_sort_network(buffer, 32);
+	else
+		small_sort_network(buffer, 64);
+
+	memcpy(array, buffer, size * sizeof(*array));
+}
+
+#ifdef __AVX2__
+
+/**
+ * small_sort_network - Sorts a buffer of 8, 16, 32 or 64 integers with a
+ * bitonic network held in AVX2 registers.
+ *
+ * @buffer: Pointer to the buffer.
+ * @size: Size of the buffer, 8, 16, 32 or 64.
+ *
+ * Description:
+ * Every register is first sorted on its own. Sorted blocks are then
+ * merged two by two: the mirrored registers of a block are compared
+ * lane-reversed, registers at a distance of 8 elements or more are
+ * compared directly, and the last 3 half-cleaners run inside each
+ * register.
+ */
+static void small_sort_network(int *buffer, size_t size)
+{
+	__m256i v[SMALL_SORT_MAX / 8], low, high;
+	__m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	size_t count = size / 8, block, distance, mirror, i;
+
+	for (i = 0; i < count; i++)
+	{
+		v[i] = _mm256_loadu_si256((__m256i *)buffer + i);
+		v[i] = sort8_register(v[i]);
+	}
+
+	for (block = 2; block <= count; block *= 2)
+	{
+		for (i = 0; i < count; i++)
+		{
+			if (i & block / 2)
+				continue;
+			mirror = i ^ (block - 1);
+			high = _mm256_permutevar8x32_epi32(v[mirror], reverse);
+			low = _mm256_min_epi32(v[i], high);
+			high = _mm256_max_epi32(v[i], high);
+			v[i] = low;
+			v[mirror] = _mm256_permutevar8x32_epi32(high, reverse);
+		}
+		for (distance = block / 4; distance > 0; distance /= 2)
+			for (i = 0; i < count; i++)
+			{
+				if (i & distance)
+					continue;
+				low = _mm256_min_epi32(v[i], v[i | distance]);
+				high = _mm256_max_epi32(v[i], v[i | distance]);
+				v[i] = low;
+				v[i | distance] = high;
+			}
+		for (i = 0; i < count; i++)
+			v[i] = clean8_register(v[i]);
+	}
+
+	for (i = 0; i < count; i++)
+		_mm256_storeu_si256((__m256i *)buffer + i, v[i]);
+}
+
+/**
+ * register_step - Runs one stage of compare-exchanges between the lanes
+ * of a register.
+ *
+ * @v: Register to update.
+ * @partner: Lane compared with each lane.
+ * @upper: All bits set in the lanes receiving the maximum of their pair.
+ *
+ * Return: The updated register.
+ */
+static __m256i register_step(__m256i v, __m256i partner, __m256i upper)
+{
+	__m256i other = _mm256_permutevar8x32_epi32(v, partner);
+
+	return (_mm256_blendv_epi8(_mm256_min_epi32(v, other),
+				   _mm256_max_epi32(v, other), upper));
+}
+
+/**
+ * sort8_register - Sorts the 8 lanes of a register with a bitonic
+ * network.
+ *
+ * @v: Register to sort.
+ *
+ * Return: The sorted register.
+ */
+static __m256i sort8_register(__m256i v)
+{
+	v = register_step(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6),
+			  _mm256_setr_epi32(0, -1, 0, -1, 0, -1, 0, -1));
+	v = register_step(v, _mm256_setr_epi32(3, 2, 1, 0, 7, 6, 5, 4),
+			  _mm256_setr_epi32(0, 0, -1, -1, 0, 0, -1, -1));
+	v = register_step(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6),
+			  _mm256_setr_epi32(0, -1, 0, -1, 0, -1, 0, -1));
+	v = register_step(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0),
+			  _mm256_setr_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+	v = register_step(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5),
+			  _mm256_setr_epi32(0, 0, -1, -1, 0, 0, -1, -1));
+
+	return (register_step(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6),
+			      _mm256_setr_epi32(0, -1, 0, -1, 0, -1, 0, -1)));
+}
+
+/**
+ * clean8_register - Runs the half-cleaners of distance 4, 2 and 1 on the
+ * lanes of a bitonic register.
+ *
+ * @v: Register to clean.
+ *
+ * Return: The sorted register.
+ */
+static __m256i clean8_register(__m256i v)
+{
+	v = register_step(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3),
+			  _mm256_setr_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+	v = register_step(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5),
+			  _mm256_setr_epi32(0, 0, -1, -1, 0, 0, -1, -1));
+
+	return (register_step(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6),
+			      _mm256_setr_epi32(0, -1, 0, -1, 0, -1, 0, -1)));
+}
+
+#else
+
+/**
+ * small_sort_network - Sorts a buffer of 8, 16, 32 or 64 integers with a
+ * bitonic network.
+ *
+ * @buffer: Pointer to the buffer.
+ * @size: Size of the buffer, 8, 16, 32 or 64.
+ *
+ * Description:
+ * This is the network of bitonic_sort_network without the bounds
+ * checks. Called with a constant size, the loops have constant trip
+ * counts, so the compiler unrolls (and vectorizes) one copy per size.
+ */
+static void small_sort_network(int *buffer, size_t size)
+{
+	size_t block, distance, i;
+
+	for (block = 2; block <= size; block *= 2)
+	{
+		for (i = 0; i < size; i++)
+			if (!(i & block / 2))
+				CMPXCHG(buffer[i], buffer[i ^ (block - 1)]);
+		for (distance = block / 4; distance > 0; distance /= 2)
+			for (i = 0; i < size; i++)
+			{
+				if (i & distance)
+					continue;
+				CMPXCHG(buffer[i], buffer[i | distance]);
+			}
+	}
+}
+
+#endif
@@ -0,0 +1,143 @@
+#include "sort.h"
+
+static void quick_parallel_step(void *step);
+static void quick_parallel_split(quick_task_t *self, size_t pivot);
+
+/**
+ * quick_sort_parallel - Sorts an array of integers with a quick sort
+ * whose partitions run on a work-stealing thread pool.
+ *
+ * @array: Pointer to the array of integers.
+ * @size: Size of the array.
+ * @threads: Number of threads, 0 for one per online processor.
+ * @grain: Size under which a partition is sorted without forking, 0 for
+ * QUICK_PARALLEL_GRAIN.
+ *
+ * Description:
+ * Partitions use the pdq_sort engine: a median of three (or ninther)
+ * pivot, the Hoare-style branchless block partition, and a single pass
+ * over runs of keys equal to the pivot. After each partition the larger
+ * side is pushed on the pool, where an idle thread steals it, while the
+ * current thread goes on with the smaller side, so the number of
+ * pending tasks per thread stays logarithmic. Partitions of `grain`
+ * elements or less are never forked, which bounds the task overhead.
+ * Ranges of PDQ_INSERTION_THRESHOLD elements or less are finished by
+ * small_sort, and after 2 * log2(size) levels a range is handed to
+ * heap_sort_bottom_up. Sorting is deterministic, so the output does not
+ * depend on the number of threads or on scheduling. It never traces.
+ */
+void quick_sort_parallel(int *array, size_t size, size_t threads,
+			 size_t grain)
+{
+	sort_pool_t *pool = NULL;
+	quick_task_t root;
+	size_t n;
+
+	if (!array || size < 2)
+		return;
+
+	threads = sort_thread_count(threads);
+	root.grain = grain ? grain : QUICK_PARALLEL_GRAIN;
+	if (threads > 1 && size > root.grain)
+		pool = malloc(sizeof(*pool));
+	if (pool)
+		sort_pool_init(pool, threads);
+
+	root.pool = pool;
+	root.array = array;
+	root.begin = 0;
+	root.end = size;
+	root.leftmost = 1;
+	for (root.depth = 0, n = size; n > 1; n >>= 1)
+		root.depth += 2;
+	quick_parallel_step(&root);
+
+	if (pool)
+	{
+		sort_pool_destroy(pool);
+		free(pool);
+	}
+}
+
+/**
+ * quick_parallel_step - Sorts the range of a parallel quick sort.
+ *
+ * @step: Pointer to the quick_task_t of the range.
+ */
+static void quick_parallel_step(void *step)
+{
+	quick_task_t *self = step;
+	int *array = self->array;
+	size_t pivot;
+	int already_partitioned;
+
+	while (self->end - self->begin > PDQ_INSERTION_THRESHOLD)
+	{
+		if (self->depth-- == 0)
+		{
+			heap_sort_bottom_up(array + self->begin,
+					    self->end - self->begin, 0);
+			return;
+		}
+
+		pdq_choose_pivot(array, self->begin, self->end);
+		if (!self->leftmost &&
+		    !(array[self->begin - 1] < array[self->begin]))
+		{
+			self->begin = pdq_partition_left(array, self->begin,
+							 self->end) + 1;
+			continue;
+		}
+
+		pivot = pdq_partition_right(array, self->begin, self->end,
+					    &already_partitioned);
+		quick_parallel_split(self, pivot);
+	}
+
+	small_sort(array + self->begin, self->end - self->begin);
+}
+
+/**
+ * quick_parallel_split - Sorts one side of a partitioned range and
+ * leaves the other one in the range.
+ *
+ * @self: Pointer to the range, updated to the side left to sort.
+ * @pivot: Final index of the pivot.
+ *
+ * Description:
+ * The smaller side is sorted first, recursively, so the stack depth
+ * stays logarithmic. When the larger side is worth forking, it is
+ * spawned before and joined after, and the range becomes empty;
+ * otherwise the range becomes the larger side, for the caller's loop.
+ */
+static void quick_parallel_split(quick_task_t *self, size_t pivot)
+{
+	quick_task_t small = *self, large = *self;
+
+	if (pivot - self->begin < self->end - pivot)
+	{
+		small.end = pivot;
+		large.begin = pivot + 1;
+		large.leftmost = 0;
+	}
+	else
+	{
+		small.begin = pivot + 1;
+		small.leftmost = 0;
+		large.end = pivot;
+	}
+
+	if (!self->pool || large.end - large.begin <= self->grain)
+	{
+		quick_parallel_step(&small);
+		self->begin = large.begin;
+		self->end = large.end;
+		self->leftmost = large.leftmost;
+		return;
+	}
+
+	sort_pool_spawn(self->pool, &large.task, quick_parallel_step, &large);
+	quick_parallel_step(&small);
+	sort_pool_join(self->pool, &large.task);
+	self->begin = self->end;
+}
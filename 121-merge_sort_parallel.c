@@ -0,0 +1,207 @@
+#include "sort.h"
+
+static void merge_parallel_sort_step(void *step);
+static void merge_parallel_merge_step(void *step);
+static size_t merge_co_rank(const int *left, size_t left_size,
+			    const int *right, size_t right_size, size_t rank);
+static void merge_fork(merge_task_t *halves, void (*routine)(void *));
+
+/**
+ * merge_sort_parallel - Sorts an array of integers with a stable merge
+ * sort whose halves and merges run on a work-stealing thread pool.
+ *
+ * @array: Pointer to the array of integers to be sorted.
+ * @size: Size of the array (number of elements).
+ * @scratch: Optional caller-owned buffer of at least `size` integers,
+ * or NULL to let the function allocate (and free) one.
+ * @threads: Number of threads, 0 for one per online processor.
+ * @grain: Size under which sorts and merges run on a single thread, 0
+ * for MERGE_PARALLEL_GRAIN.
+ *
+ * Description:
+ * Like merge_sort, the array is split in halves that are sorted
+ * recursively, here concurrently, then merged. Every thread works on
+ * its own range of the one shared buffer, and the levels ping-pong
+ * between the array and the buffer, so nothing is copied back. A merge
+ * is itself split in two by co-ranking: a binary search finds how many
+ * elements of each run come before the middle of the output, so both
+ * halves of the output can be merged independently and the last merge
+ * is not a serial O(n) step. Ranges of `grain` elements or less are
+ * sorted by merge_sort_bottom_up. Ties always go to the left run, so
+ * the sort is stable and the result is that of merge_sort. It never
+ * traces.
+ */
+void merge_sort_parallel(int *array, size_t size, int *scratch,
+			 size_t threads, size_t grain)
+{
+	sort_pool_t *pool = NULL;
+	merge_task_t root;
+
+	if (!array || size < 2)
+		return;
+
+	root.buffer = scratch ? scratch : malloc(sizeof(int) * size);
+	if (!root.buffer)
+		return;
+
+	threads = sort_thread_count(threads);
+	root.grain = grain ? grain : MERGE_PARALLEL_GRAIN;
+	if (threads > 1 && size > root.grain)
+		pool = malloc(sizeof(*pool));
+	if (pool)
+		sort_pool_init(pool, threads);
+
+	root.pool = pool;
+	root.array = array;
+	root.size = size;
+	root.to_buffer = 0;
+	merge_parallel_sort_step(&root);
+
+	if (pool)
+	{
+		sort_pool_destroy(pool);
+		free(pool);
+	}
+	if (!scratch)
+		free(root.buffer);
+}
+
+/**
+ * merge_parallel_sort_step - Sorts the range of a step.
+ *
+ * @step: Pointer to the merge_task_t of the range.
+ *
+ * Description:
+ * Both halves are sorted into the other buffer, then merged into the
+ * one the step must leave its result in. A range of `grain` elements
+ * or less is sorted by merge_sort_bottom_up when its result belongs in
+ * the array. When it belongs in the buffer, its halves are sorted that
+ * way on the calling thread and merged into the buffer, which costs no
+ * more passes than one merge_sort_bottom_up and copies nothing.
+ */
+static void merge_parallel_sort_step(void *step)
+{
+	merge_task_t *self = step, halves[2];
+	size_t half = self->size / 2;
+
+	if (!self->to_buffer && (!self->pool || self->size <= self->grain))
+	{
+		merge_sort_bottom_up(self->array, self->size, self->buffer);
+		return;
+	}
+	if (self->size < 2)
+	{
+		*self->buffer = *self->array;
+		return;
+	}
+
+	halves[0] = *self;
+	/* A leaf due in the buffer sorts its halves serially, then merges */
+	halves[0].pool = self->size > self->grain ? self->pool : NULL;
+	halves[0].size = half;
+	halves[0].to_buffer = !self->to_buffer;
+	halves[1] = halves[0];
+	halves[1].array += half;
+	halves[1].buffer += half;
+	halves[1].size = self->size - half;
+	merge_fork(halves, merge_parallel_sort_step);
+
+	halves[0].left = self->to_buffer ? self->array : self->buffer;
+	halves[0].left_size = half;
+	halves[0].right = halves[0].left + half;
+	halves[0].right_size = self->size - half;
+	halves[0].out = self->to_buffer ? self->buffer : self->array;
+	merge_parallel_merge_step(&halves[0]);
+}
+
+/**
+ * merge_parallel_merge_step - Merges the two sorted runs of a step.
+ *
+ * @step: Pointer to the merge_task_t of the runs.
+ */
+static void merge_parallel_merge_step(void *step)
+{
+	merge_task_t *self = step, halves[2];
+	size_t total = self->left_size + self->right_size, i = 0, j = 0, k;
+
+	if (total > self->grain)
+	{
+		k = total / 2;
+		i = merge_co_rank(self->left, self->left_size,
+				  self->right, self->right_size, k);
+		halves[0] = *self;
+		halves[0].left_size = i;
+		halves[0].right_size = k - i;
+		halves[1] = *self;
+		halves[1].left += i;
+		halves[1].left_size -= i;
+		halves[1].right += k - i;
+		halves[1].right_size -= k - i;
+		halves[1].out += k;
+		merge_fork(halves, merge_parallel_merge_step);
+		return;
+	}
+
+	for (k = 0; i < self->left_size && j < self->right_size; k++)
+		if (self->right[j] < self->left[i])
+			self->out[k] = self->right[j++];
+		else
+			self->out[k] = self->left[i++];
+	while (i < self->left_size)
+		self->out[k++] = self->left[i++];
+	while (j < self->right_size)
+		self->out[k++] = self->right[j++];
+}
+
+/**
+ * merge_co_rank - Finds how many elements of the left run are among the
+ * first `rank` elements of the stable merge of two sorted runs.
+ *
+ * @left: First sorted run, whose elements win ties.
+ * @left_size: Number of elements of `left`.
+ * @right: Second sorted run.
+ * @right_size: Number of elements of `right`.
+ * @rank: Number of merged elements, at most left_size + right_size.
+ *
+ * Return: The count i of left elements; the other rank - i come from
+ * the right run.
+ */
+static size_t merge_co_rank(const int *left, size_t left_size,
+			    const int *right, size_t right_size, size_t rank)
+{
+	size_t low = rank > right_size ? rank - right_size : 0;
+	size_t high = rank < left_size ? rank : left_size, i;
+
+	/* Smallest i such that left[i] sorts after right[rank - i - 1] */
+	while (low < high)
+	{
+		i = low + (high - low) / 2;
+		if (right[rank - i - 1] < left[i])
+			high = i;
+		else
+			low = i + 1;
+	}
+
+	return (low);
+}
+
+/**
+ * merge_fork - Runs two independent steps, the first one on any thread
+ * of the pool and the second one on the calling thread.
+ *
+ * @halves: Pointer to the two steps.
+ * @routine: Routine running a step.
+ */
+static void merge_fork(merge_task_t *halves, void (*routine)(void *))
+{
+	if (!halves[0].pool)
+	{
+		routine(&halves[0]);
+		routine(&halves[1]);
+		return;
+	}
+
+	sort_pool_spawn(halves[0].pool, &halves[0].task, routine, &halves[0]);
+	routine(&halves[1]);
+	sort_pool_join(halves[0].pool, &halves[0].task);
+}
@@ -0,0 +1,185 @@
+#include <limits.h>
+#include "sort.h"
+
+static void *merge_k_slice(void *task);
+static void merge_k_split(const int_span_t *spans, size_t count,
+			  size_t rank, int_span_t *cuts);
+static size_t merge_k_count(const int_span_t *spans, size_t count,
+			    int64_t value, int upper);
+static size_t merge_k_bound(const int *array, size_t size, int64_t value,
+			    int upper);
+
+/**
+ * merge_k_parallel - Merges K sorted arrays into one sorted array, each
+ * thread producing its own slice of the output.
+ *
+ * @spans: Pointer to the K sorted arrays (an array may be empty).
+ * @count: Number of arrays, K.
+ * @output: Pointer to the destination, which must hold the sum of the
+ * sizes of the arrays and must not overlap them.
+ * @threads: Number of threads, 0 for one per online processor.
+ *
+ * Description:
+ * The output is cut into one slice of equal length per thread. Each
+ * thread finds, by a splitter search over the values, where its first
+ * and last output elements lie in every array, then merges the K
+ * sub-arrays between them with merge_k. Ties between arrays are split
+ * in array order, so the result is exactly that of merge_k. Small
+ * merges, or a single thread, use merge_k directly.
+ */
+void merge_k_parallel(const int_span_t *spans, size_t count, int *output,
+		      size_t threads)
+{
+	merge_k_task_t *tasks;
+	int_span_t *slices;
+	size_t total = 0, i;
+
+	for (i = 0; i < count; i++)
+		total += spans[i].size;
+	threads = sort_thread_count(threads);
+	threads = threads < SORT_MAX_THREADS ? threads : SORT_MAX_THREADS;
+	if (threads < 2 || total < MERGE_K_PARALLEL_THRESHOLD)
+	{
+		merge_k(spans, count, output);
+		return;
+	}
+
+	tasks = malloc(sizeof(*tasks) * threads);
+	slices = malloc(sizeof(*slices) * count * 2 * threads);
+	if (tasks && slices)
+	{
+		for (i = 0; i < threads; i++)
+		{
+			tasks[i].spans = spans;
+			tasks[i].count = count;
+			tasks[i].slices = slices + count * 2 * i;
+			tasks[i].begin = total / threads * i;
+			tasks[i].end = i + 1 < threads ?
+				total / threads * (i + 1) : total;
+			tasks[i].output = output;
+		}
+		sort_run_parallel(merge_k_slice, tasks, sizeof(*tasks),
+				  threads);
+	}
+	else
+	{
+		merge_k(spans, count, output);
+	}
+
+	free(tasks);
+	free(slices);
+}
+
+/**
+ * merge_k_slice - Merges the slice of the output of one thread.
+ *
+ * @task: Pointer to the merge_k_task_t of the slice.
+ *
+ * Return: Always NULL.
+ */
+static void *merge_k_slice(void *task)
+{
+	merge_k_task_t *self = task;
+	int_span_t *first = self->slices, *last = self->slices + self->count;
+	size_t i;
+
+	merge_k_split(self->spans, self->count, self->begin, first);
+	merge_k_split(self->spans, self->count, self->end, last);
+	for (i = 0; i < self->count; i++)
+		first[i].size = last[i].array - first[i].array;
+
+	merge_k(first, self->count, self->output + self->begin);
+
+	return (NULL);
+}
+
+/**
+ * merge_k_split - Finds where the first `rank` elements of the merge end
+ * in every array.
+ *
+ * @spans: The sorted arrays.
+ * @count: Number of arrays.
+ * @rank: Number of elements of the merge before the cut.
+ * @cuts: Receives, for every array, a pointer to its first element
+ * that comes after the cut (the size is left unset).
+ *
+ * Description:
+ * A binary search over the int values finds the smallest value v that
+ * has at least `rank` elements less than or equal to it. Every element
+ * smaller than v is before the cut, and the elements equal to v needed
+ * to reach `rank` are taken from the arrays in order, as merge_k would.
+ */
+static void merge_k_split(const int_span_t *spans, size_t count,
+			  size_t rank, int_span_t *cuts)
+{
+	int64_t low = INT_MIN, high = INT_MAX, middle;
+	size_t i, lower, upper;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (merge_k_count(spans, count, middle, 1) < rank)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	rank -= merge_k_count(spans, count, low, 0);
+	for (i = 0; i < count; i++)
+	{
+		lower = merge_k_bound(spans[i].array, spans[i].size, low, 0);
+		upper = merge_k_bound(spans[i].array, spans[i].size, low, 1);
+		upper = upper - lower < rank ? upper : lower + rank;
+		rank -= upper - lower;
+		cuts[i].array = spans[i].array + upper;
+	}
+}
+
+/**
+ * merge_k_count - Counts the elements of all arrays below a value.
+ *
+ * @spans: The sorted arrays.
+ * @count: Number of arrays.
+ * @value: Value to compare with.
+ * @upper: Whether to count the elements equal to `value` too.
+ *
+ * Return: The number of elements less than (or equal to) `value`.
+ */
+static size_t merge_k_count(const int_span_t *spans, size_t count,
+			    int64_t value, int upper)
+{
+	size_t total = 0, i;
+
+	for (i = 0; i < count; i++)
+		total += merge_k_bound(spans[i].array, spans[i].size, value,
+				       upper);
+
+	return (total);
+}
+
+/**
+ * merge_k_bound - Counts the elements of a sorted array below a value.
+ *
+ * @array: The sorted array.
+ * @size: Number of elements of the array.
+ * @value: Value to compare with.
+ * @upper: Whether to count the elements equal to `value` too.
+ *
+ * Return: The number of elements less than (or equal to) `value`.
+ */
+static size_t merge_k_bound(const int *array, size_t size, int64_t value,
+			    int upper)
+{
+	size_t low = 0, high = size, middle;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (array[middle] < value || (upper && array[middle] == value))
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return (low);
+}
@@ -0,0 +1,119 @@
+#include "sort.h"
+
+static listint_t *list_cut_run(listint_t **rest);
+static listint_t *list_merge(listint_t *left, listint_t *right);
+
+/**
+ * merge_sort_list - Sorts a doubly linked list of integers in ascending
+ * order with a bottom-up natural merge sort.
+ *
+ * @list: Pointer to a pointer to the head of the doubly linked list.
+ *
+ * Description:
+ * The list is cut into its natural runs (strictly descending runs are
+ * reversed), and each run is pushed onto a binary counter of pending
+ * lists, pending[k] holding the merge of about 2^k runs: a new run is
+ * merged with pending[0], the result with pending[1], and so on, like
+ * the carries of an increment. Only the next pointers are relinked
+ * while merging; prev is fixed in one final pass. A sorted list is a
+ * single run and finishes in one scan. Ties keep their order, so the
+ * sort is stable, and it never traces.
+ */
+void merge_sort_list(listint_t **list)
+{
+	listint_t *pending[sizeof(size_t) * 8] = {NULL}, *rest, *run, *prev;
+	size_t level, top = 0;
+
+	if (!list || !*list || !(*list)->next)
+		return;
+
+	for (rest = *list; rest;)
+	{
+		run = list_cut_run(&rest);
+		for (level = 0; level < top && pending[level]; level++)
+		{
+			run = list_merge(pending[level], run);
+			pending[level] = NULL;
+		}
+		pending[level] = run;
+		top = level < top ? top : level + 1;
+	}
+
+	for (run = NULL, level = 0; level < top; level++)
+		run = pending[level] ? list_merge(pending[level], run) : run;
+
+	*list = run;
+	for (prev = NULL; run; prev = run, run = run->next)
+		run->prev = prev;
+}
+
+/**
+ * list_cut_run - Detaches the natural run at the head of a list.
+ *
+ * @rest: Pointer to the head of the list, advanced past the run.
+ *
+ * Description:
+ * A run is the longest non-decreasing prefix, or the longest strictly
+ * decreasing one, which is reversed. Reversing a strictly decreasing
+ * run cannot swap equal elements, so stability is preserved.
+ *
+ * Return: The head of the run, whose last node's next is NULL.
+ */
+static listint_t *list_cut_run(listint_t **rest)
+{
+	listint_t *head = *rest, *tail = head, *next;
+
+	if (tail->next && tail->next->n < tail->n)
+	{
+		/* Reverse while strictly decreasing, next pointers only */
+		next = tail->next;
+		tail->next = NULL;
+		while (next && next->n < head->n)
+		{
+			*rest = next->next;
+			next->next = head;
+			head = next;
+			next = *rest;
+		}
+		*rest = next;
+		return (head);
+	}
+
+	while (tail->next && tail->n <= tail->next->n)
+		tail = tail->next;
+	*rest = tail->next;
+	tail->next = NULL;
+
+	return (head);
+}
+
+/**
+ * list_merge - Merges two sorted lists through their next pointers.
+ *
+ * @left: Head of the first list, whose nodes win ties.
+ * @right: Head of the second list.
+ *
+ * Return: The head of the merged list.
+ */
+static listint_t *list_merge(listint_t *left, listint_t *right)
+{
+	listint_t head, *tail = &head;
+
+	while (left && right)
+	{
+		if (right->n < left->n)
+		{
+			tail->next = right;
+			right = right->next;
+		}
+		else
+		{
+			tail->next = left;
+			left = left->next;
+		}
+		tail = tail->next;
+	}
+	tail->next = left ? left : right;
+
+	return (head.next);
+}
@@ -0,0 +1,77 @@
+#include "sort.h"
+
+/* radix_sort_list_key, falling back on heap_sort_list_key */
+#define TYPED_T list_key_t
+#define TYPED_NAME(name) name##_list_key
+#define TYPED_LESS(a, b) ((a).key < (b).key)
+#define TYPED_KEY_T uint32_t
+#define TYPED_KEY(x) ((x).key)
+#define TYPED_KEY_BYTES 4
+#define TYPED_LINKAGE static
+#include "typed_heap.h"
+#include "typed_radix.h"
+#undef TYPED_T
+#undef TYPED_NAME
+#undef TYPED_LESS
+#undef TYPED_KEY_T
+#undef TYPED_KEY
+#undef TYPED_KEY_BYTES
+#undef TYPED_LINKAGE
+
+/**
+ * radix_sort_list - Sorts a doubly linked list of integers in ascending
+ * order through a contiguous array of its keys.
+ *
+ * @list: Pointer to a pointer to the head of the doubly linked list.
+ *
+ * Description:
+ * A list found sorted while its nodes are counted is left as it is.
+ * Otherwise every node is visited once more to gather a (key, node)
+ * pair, the pairs are radix sorted as an array, and prev and next are
+ * rewritten in one pass over the sorted pairs. The only pointer
+ * chasing is the gather, so long lists whose nodes are scattered in
+ * memory sort at nearly the speed of an array. Lists of fewer than
+ * RADIX_LIST_THRESHOLD nodes, or whose pairs cannot be allocated, use
+ * merge_sort_list instead. The sort is stable unless the radix buffer
+ * cannot be allocated either (the pairs are then heap sorted), and it
+ * never traces.
+ */
+void radix_sort_list(listint_t **list)
+{
+	listint_t *node;
+	list_key_t *keys;
+	size_t size = 0, sorted = 1, i;
+
+	if (!list || !*list)
+		return;
+
+	for (node = *list; node; node = node->next, size++)
+		sorted &= !node->next || node->n <= node->next->n;
+	if (sorted)
+		return;
+	keys = size < RADIX_LIST_THRESHOLD ? NULL :
+		malloc(sizeof(*keys) * size);
+	if (!keys)
+	{
+		merge_sort_list(list);
+		return;
+	}
+
+	for (i = 0, node = *list; node; node = node->next, i++)
+	{
+		keys[i].key = RADIX_KEY(node->n);
+		keys[i].node = node;
+	}
+	radix_sort_list_key(keys, size);
+
+	*list = keys[0].node;
+	keys[0].node->prev = NULL;
+	for (i = 1; i < size; i++)
+	{
+		keys[i].node->prev = keys[i - 1].node;
+		keys[i - 1].node->next = keys[i].node;
+	}
+	keys[size - 1].node->next = NULL;
+
+	free(keys);
+}
@@ -1,7 +1,5 @@
 #include "sort.h"
 
-void swap(int *a, int *b);
-
 /**
  * selection_sort - Sorts an array of integers in ascending order using
  * the Selection Sort algorithm.
@@ -45,31 +43,7 @@ void selection_sort(int *array, size_t size)
 		if (swapped)
 		{
 			swap(&array[i], &array[min_index]);
-			print_array(array, size);
+			TRACE_ARRAY(array, size);
 		}
 	}
 }
-
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
@@ -1,8 +1,8 @@
 #include "sort.h"
 
-void _quick_sort(int *array, size_t left, size_t right, size_t size);
-size_t Lomuto_partition(int *array, size_t left, size_t right, size_t size);
-void swap(int *a, int *b);
+static void _quick_sort(int *array, size_t left, size_t right, size_t size);
+static size_t Lomuto_partition(int *array, size_t left, size_t right,
+			       size_t size);
 
 /**
  * quick_sort - Sorts an array of integers in ascending order using
@@ -45,7 +45,7 @@ void quick_sort(int *array, size_t size)
  * Note:
  * - The input array must be a valid array of integers.
  */
-void _quick_sort(int *array, size_t left, size_t right, size_t size)
+static void _quick_sort(int *array, size_t left, size_t right, size_t size)
 {
 	size_t pivot;
 
@@ -80,7 +80,8 @@ void _quick_sort(int *array, size_t left, size_t right, size_t size)
  * Return:
  * The index of the pivot element after the partitioning process.
  */
-size_t Lomuto_partition(int *array, size_t left, size_t right, size_t size)
+static size_t Lomuto_partition(int *array, size_t left, size_t right,
+			       size_t size)
 {
 	int pivot = array[right];
 	size_t high, low;
@@ -92,7 +93,7 @@ size_t Lomuto_partition(int *array, size_t left, size_t right, size_t size)
 			if (low > high)
 			{
 				swap(&array[high], &array[low]);
-				print_array(array, size);
+				TRACE_ARRAY(array, size);
 			}
 
 			high++;
@@ -102,32 +103,8 @@ size_t Lomuto_partition(int *array, size_t left, size_t right, size_t size)
 	if (array[high] > pivot)
 	{
 		swap(&array[high], &array[right]);
-		print_array(array, size);
+		TRACE_ARRAY(array, size);
 	}
 
 	return (high);
 }
-
-/**
- * swap - Swaps the values of two integers.
- *
- * @a: Pointer to the first integer.
- * @b: Pointer to the second integer.
- *
- * Description:
- * This function swaps the values of the integers pointed to by `a` and `b`.
- *
- * Note:
- * - The input pointers `a` and `b` must be valid pointers to integers.
- */
-void swap(int *a, int *b)
-{
-	int tmp;
-
-	if (!a || !b)
-		return;
-	tmp = *a;
-
-	*a = *b;
-	*b = tmp;
-}
@@ -0,0 +1,140 @@
+#include <time.h>
+#include "../deck.h"
+
+#define DECK_BENCH_ROUNDS 5
+
+/**
+ * deal - Links the nodes of every deck in block order and shuffles the
+ * cards they hold
+ *
+ * @blocks: First node of the 52 contiguous nodes of every deck
+ * @decks: Receives the head of every deck
+ * @count: Number of decks
+ * @seed: State of the pseudo-random generator
+ */
+void deal(deck_node_t **blocks, deck_node_t **decks, size_t count,
+	  unsigned long *seed)
+{
+	const card_t *card;
+	size_t d, i, j;
+
+	for (d = 0; d < count; d++)
+	{
+		for (i = 0; i < 52; i++)
+		{
+			blocks[d][i].prev = i ? &blocks[d][i - 1] : NULL;
+			blocks[d][i].next = i < 51 ? &blocks[d][i + 1] : NULL;
+		}
+		for (i = 51; i > 0; i--)
+		{
+			*seed = *seed * 6364136223846793005UL +
+				1442695040888963407UL;
+			j = (*seed >> 33) % (i + 1);
+			card = blocks[d][i].card;
+			blocks[d][i].card = blocks[d][j].card;
+			blocks[d][j].card = card;
+		}
+		decks[d] = blocks[d];
+	}
+}
+
+/**
+ * run_round - Sorts every deck once and times it
+ *
+ * @decks: Heads of the decks
+ * @count: Number of decks
+ * @mode: 0 for sort_deck on every deck, otherwise sort_decks with
+ * @threads threads
+ * @threads: Number of threads of sort_decks
+ *
+ * Return: Elapsed time in seconds
+ */
+double run_round(deck_node_t **decks, size_t count, int mode, size_t threads)
+{
+	struct timespec start, end;
+	size_t d;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (mode)
+		sort_decks(decks, count, threads);
+	else
+		for (d = 0; d < count; d++)
+			sort_deck(&decks[d]);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return ((end.tv_sec - start.tv_sec) +
+		(end.tv_nsec - start.tv_nsec) / 1e9);
+}
+
+/**
+ * bench_mode - Prints the best throughput of one way of sorting decks
+ *
+ * @name: Label of the line
+ * @blocks: First node of every deck
+ * @decks: Heads of the decks
+ * @count: Number of decks
+ * @mode: As run_round
+ * @threads: As run_round
+ */
+void bench_mode(const char *name, deck_node_t **blocks, deck_node_t **decks,
+		size_t count, int mode, size_t threads)
+{
+	unsigned long seed = 42;
+	double best = 0, elapsed;
+	int round;
+
+	for (round = 0; round < DECK_BENCH_ROUNDS; round++)
+	{
+		deal(blocks, decks, count, &seed);
+		elapsed = run_round(decks, count, mode, threads);
+		best = !round || elapsed < best ? elapsed : best;
+	}
+	printf("%-24s %14.0f\n", name, count / (best > 0 ? best : 1e-9));
+}
+
+/**
+ * main - Measures how many shuffled 52-card decks are sorted per second
+ *
+ * Description: Every deck is dealt from the same card_t array, as in a
+ * simulation, and its nodes come from one node pool. The best of
+ * DECK_BENCH_ROUNDS rounds is reported for sort_deck called per deck,
+ * then for sort_decks on one thread and on the requested threads.
+ *
+ * @argc: Number of arguments
+ * @argv: argv[1] optionally holds the number of decks (default 100000),
+ * argv[2] the number of threads (default 0, one per processor)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+	static const char *const values[] = {"Ace", "2", "3", "4", "5", "6",
+		"7", "8", "9", "10", "Jack", "Queen", "King"};
+	size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000, d;
+	size_t threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 0;
+	deck_node_t **blocks = malloc(sizeof(*blocks) * (count + 1));
+	deck_node_t **decks = malloc(sizeof(*decks) * (count + 1));
+	card_t cards[52] = {{NULL, SPADE}};
+	node_pool_t pool;
+
+	for (d = 0; d < 52; d++)
+	{
+		cards[d].value = values[d % 13];
+		*(kind_t *)&cards[d].kind = (kind_t)(d / 13);
+	}
+	node_pool_init(&pool, sizeof(deck_node_t), 0);
+	for (d = 0; blocks && d < count; d++)
+		blocks[d] = deck_pool_build(&pool, cards, 52);
+	if (!count || !blocks || !decks || !blocks[count - 1])
+		return (1);
+
+	printf("%-24s %14s\n", "sort", "decks/s");
+	bench_mode("sort_deck", blocks, decks, count, 0, 1);
+	bench_mode("sort_decks, 1 thread", blocks, decks, count, 1, 1);
+	bench_mode("sort_decks, threads", blocks, decks, count, 1, threads);
+
+	node_pool_destroy(&pool);
+	free(blocks);
+	free(decks);
+	return (0);
+}
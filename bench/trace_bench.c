@@ -0,0 +1,104 @@
+#include <time.h>
+#include "../sort.h"
+
+#ifndef BENCH_SORT
+#error "BENCH_SORT must name the sort to benchmark, e.g. -DBENCH_SORT=quick_sort"
+#endif
+
+/**
+ * create_listint - Creates a doubly linked list from an array of integers
+ *
+ * @array: Array to convert to a doubly linked list
+ * @size: Size of the array
+ *
+ * Return: Pointer to the first element of the created list. NULL on failure
+ */
+listint_t *create_listint(const int *array, size_t size)
+{
+	listint_t *list;
+	listint_t *node;
+	int *tmp;
+
+	list = NULL;
+	while (size--)
+	{
+		node = malloc(sizeof(*node));
+		if (!node)
+			return (NULL);
+		tmp = (int *)&node->n;
+		*tmp = array[size];
+		node->next = list;
+		node->prev = NULL;
+		list = node;
+		if (list->next)
+			list->next->prev = list;
+	}
+	return (list);
+}
+
+/**
+ * run_sort - Runs the benchmarked sort once on a copy of the input
+ *
+ * @array: Input to sort, left untouched for arrays built into lists
+ * @size: Number of elements in @array
+ *
+ * Return: Elapsed time in seconds, or -1 on allocation failure
+ */
+double run_sort(int *array, size_t size)
+{
+	struct timespec start, end;
+#ifdef BENCH_LIST
+	listint_t *list = create_listint(array, size), *next;
+
+	if (!list)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	BENCH_SORT(&list);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	for (; list; list = next)
+	{
+		next = list->next;
+		free(list);
+	}
+#else
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	BENCH_SORT(array, size);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+#endif
+	return ((end.tv_sec - start.tv_sec) +
+		(end.tv_nsec - start.tv_nsec) / 1e9);
+}
+
+/**
+ * main - Times one sort on a reproducible pseudo-random input
+ *
+ * Description: The sort is selected at compile time with -DBENCH_SORT
+ * (and -DBENCH_LIST for list sorts). The traced steps go to stdout and
+ * the elapsed time to stderr, so stdout can be sent to /dev/null.
+ *
+ * @argc: Number of arguments
+ * @argv: argv[1] optionally holds the number of elements (default 1024)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t size = argc > 1 ? strtoul(argv[1], NULL, 10) : 1024, i;
+	int *array = malloc(sizeof(*array) * size);
+	unsigned long seed = 42;
+	double elapsed;
+
+	if (!array)
+		return (1);
+	for (i = 0; i < size; i++)
+	{
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		array[i] = (int)((seed >> 33) % (size * 4));
+	}
+	elapsed = run_sort(array, size);
+	free(array);
+	if (elapsed < 0)
+		return (1);
+	fprintf(stderr, "%.6f\n", elapsed);
+	return (0);
+}
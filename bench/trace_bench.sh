@@ -0,0 +1,44 @@
+#!/bin/sh
+# Compares every sort built with tracing (output sent to /dev/null)
+# against the same sort built with -DSORT_NO_TRACE. The optional fourth
+# column lists the other sources a sort needs.
+#
+# Usage: bench/trace_bench.sh [size]
+
+SIZE=${1:-512}
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:-"-Wall -Werror -Wextra -pedantic -std=gnu89 -O2"}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+printf "%-20s %12s %12s %10s\n" "sort" "traced (s)" "no trace (s)" "speedup"
+while read -r file sort kind deps; do
+	[ "$kind" = list ] && extra=-DBENCH_LIST || extra=
+	sources=
+	for dep in $deps; do sources="$sources $ROOT/$dep"; done
+	for mode in traced stripped; do
+		[ "$mode" = stripped ] && strip=-DSORT_NO_TRACE || strip=
+		$CC $CFLAGS $extra $strip -DBENCH_SORT="$sort" -o "$TMP/$mode" \
+			"$ROOT/bench/trace_bench.c" "$ROOT/$file" "$ROOT/swap.c" \
+			"$ROOT/trace.c" $sources \
+			"$ROOT/print_array.c" "$ROOT/print_list.c" || exit 1
+	done
+	traced=$("$TMP/traced" "$SIZE" 2>&1 >/dev/null)
+	stripped=$("$TMP/stripped" "$SIZE" 2>&1 >/dev/null)
+	printf "%-20s %12s %12s %9.1fx\n" "$sort" "$traced" "$stripped" \
+		"$(echo "$traced $stripped" | awk '{ print $1 / ($2 > 0 ? $2 : 1e-9) }')"
+done <<LIST
+0-bubble_sort.c bubble_sort array
+1-insertion_sort_list.c insertion_sort_list list
+2-selection_sort.c selection_sort array
+3-quick_sort.c quick_sort array
+100-shell_sort.c shell_sort array
+101-cocktail_sort_list.c cocktail_sort_list list
+102-counting_sort.c counting_sort array
+103-merge_sort.c merge_sort array loser_tree.c 116-heap_sort_bottom_up.c
+104-heap_sort.c heap_sort array
+105-radix_sort.c radix_sort array
+106-bitonic_sort.c bitonic_sort array 117-bitonic_sort_network.c
+107-quick_sort_hoare.c quick_sort_hoare array
+LIST
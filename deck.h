@@ -2,6 +2,15 @@
 #define DECK_H
 
 #include <stdlib.h>
+#include "sort.h"
+
+#define DECK_SUITS 4
+#define DECK_RANKS 13
+/* Every suit has one more bucket, after its King, for unknown values */
+#define DECK_BUCKETS (DECK_SUITS * (DECK_RANKS + 1))
+#define DECK_CACHE_SIZE 128
+#define DECK_CACHE_PROBES 8
+#define DECK_BATCH_GRAIN 1024
 
 /**
  * enum kind_e - Enumerates the four suits of a playing card.
@@ -50,12 +59,62 @@ typedef struct deck_node_s
 	struct deck_node_s *next;
 } deck_node_t;
 
+/**
+ * struct deck_cache_s - Buckets of the cards seen by a batch of sorts
+ *
+ * @cards: Card of every slot, NULL for a free slot
+ * @buckets: card_bucket of the card of every slot
+ *
+ * Description:
+ * Slots are indexed by the address of the card divided by its size, so
+ * the cards of one array fill consecutive slots without collisions.
+ */
+typedef struct deck_cache_s
+{
+	const card_t *cards[DECK_CACHE_SIZE];
+	unsigned char buckets[DECK_CACHE_SIZE];
+} deck_cache_t;
+
+/**
+ * struct deck_batch_task_s - Decks sorted by one thread of sort_decks
+ *
+ * @decks: Pointer to the heads of the decks
+ * @count: Number of decks
+ */
+typedef struct deck_batch_task_s
+{
+	deck_node_t **decks;
+	size_t count;
+} deck_batch_task_t;
+
+/* Entry points exported by libsort.so, see sort.h */
+#pragma GCC visibility push(default)
+
 /* 1000-sort_deck */
 void sort_deck(deck_node_t **deck);
 
+/* deck_batch.c */
+void sort_decks(deck_node_t **decks, size_t count, size_t threads);
+
+/* deck_pool.c */
+deck_node_t *deck_pool_build(node_pool_t *pool, const card_t *cards,
+			     size_t count);
+int deck_pool_compact(node_pool_t *pool, deck_node_t **deck);
+
+#pragma GCC visibility pop
+
+/* 1000-sort_deck */
 int compare_cards_kind(const void *a, const void *b);
 int compare_cards_value(const void *a, const void *b);
 int _strcmp(const char *str1, const char *str2);
 long int _atoi(const char *str);
 
+/* deck_rank.c */
+size_t card_rank(const char *value);
+size_t card_bucket(const card_t *card);
+
+/* deck_buckets.c */
+void deck_sort_buckets(deck_node_t **deck, deck_cache_t *cache);
+size_t card_bucket_cached(deck_cache_t *cache, const card_t *card);
+
 #endif /* DECK_H */
@@ -0,0 +1,71 @@
+#include "deck.h"
+
+static void *sort_decks_slice(void *task);
+
+/**
+ * sort_decks - Sorts many decks of cards in one call.
+ *
+ * @decks: Array of pointers to the heads of the decks, each updated to
+ * its sorted deck (a NULL head is left as it is).
+ * @count: Number of decks.
+ * @threads: Number of threads, 0 for one per online processor.
+ *
+ * Description:
+ * Every deck is sorted as by sort_deck, but each thread keeps one
+ * deck_cache_t for all the decks it sorts, so a card shared by many
+ * decks (e.g. one card_t array dealt over and over) is parsed once per
+ * thread instead of once per deck. The decks are split in equal slices
+ * between the threads, with at least DECK_BATCH_GRAIN decks per
+ * thread; the decks must not share nodes.
+ */
+void sort_decks(deck_node_t **decks, size_t count, size_t threads)
+{
+	deck_batch_task_t *tasks, whole;
+	size_t i;
+
+	if (!decks || !count)
+		return;
+
+	threads = sort_thread_count(threads);
+	threads = threads < SORT_MAX_THREADS ? threads : SORT_MAX_THREADS;
+	threads = threads < count / DECK_BATCH_GRAIN ? threads :
+		count / DECK_BATCH_GRAIN;
+	tasks = threads > 1 ? malloc(sizeof(*tasks) * threads) : NULL;
+	if (!tasks)
+	{
+		whole.decks = decks;
+		whole.count = count;
+		sort_decks_slice(&whole);
+		return;
+	}
+
+	for (i = 0; i < threads; i++)
+	{
+		tasks[i].decks = decks + count / threads * i;
+		tasks[i].count = i + 1 < threads ? count / threads :
+			count - count / threads * i;
+	}
+	sort_run_parallel(sort_decks_slice, tasks, sizeof(*tasks), threads);
+
+	free(tasks);
+}
+
+/**
+ * sort_decks_slice - Sorts the decks of one thread.
+ *
+ * @task: Pointer to the deck_batch_task_t of the thread.
+ *
+ * Return: Always NULL.
+ */
+static void *sort_decks_slice(void *task)
+{
+	deck_batch_task_t *self = task;
+	deck_cache_t cache;
+	size_t i;
+
+	memset(&cache, 0, sizeof(cache));
+	for (i = 0; i < self->count; i++)
+		deck_sort_buckets(&self->decks[i], &cache);
+
+	return (NULL);
+}
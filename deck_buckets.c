@@ -0,0 +1,83 @@
+#include <stdint.h>
+#include "deck.h"
+
+/**
+ * deck_sort_buckets - Sorts a deck by distributing its cards into
+ * (suit, rank) buckets.
+ *
+ * @deck: Pointer to the head of the deck.
+ * @cache: Cache of the buckets of the cards, or NULL to parse every card.
+ *
+ * Description:
+ * Each node is appended to the list of its bucket, prev being set as it
+ * goes, then the non-empty buckets are chained in order. It runs in
+ * linear time with no comparison, and equal cards keep their order.
+ */
+void deck_sort_buckets(deck_node_t **deck, deck_cache_t *cache)
+{
+	deck_node_t *heads[DECK_BUCKETS], *tails[DECK_BUCKETS];
+	deck_node_t *node, *next, *last = NULL;
+	size_t bucket;
+
+	if (!*deck)
+		return;
+
+	memset(heads, 0, sizeof(heads));
+	for (node = *deck; node; node = next)
+	{
+		next = node->next;
+		bucket = cache ? card_bucket_cached(cache, node->card) :
+			card_bucket(node->card);
+		node->prev = heads[bucket] ? tails[bucket] : NULL;
+		if (heads[bucket])
+			tails[bucket]->next = node;
+		else
+			heads[bucket] = node;
+		tails[bucket] = node;
+	}
+
+	*deck = NULL;
+	for (bucket = 0; bucket < DECK_BUCKETS; bucket++)
+	{
+		if (!heads[bucket])
+			continue;
+		heads[bucket]->prev = last;
+		*(last ? &last->next : deck) = heads[bucket];
+		last = tails[bucket];
+	}
+	last->next = NULL;
+}
+
+/**
+ * card_bucket_cached - Computes the bucket of a card through a cache.
+ *
+ * @cache: The cache, zeroed before its first use.
+ * @card: The card, whose value and suit must not change while the
+ * cache is in use.
+ *
+ * Description:
+ * A card is parsed the first time it is seen, and found again by its
+ * address afterwards. Up to DECK_CACHE_PROBES slots are probed; when
+ * they are all taken by other cards, the card is parsed uncached.
+ *
+ * Return: The bucket of the card, as card_bucket.
+ */
+size_t card_bucket_cached(deck_cache_t *cache, const card_t *card)
+{
+	size_t slot = (uintptr_t)card / sizeof(*card), probe;
+
+	for (probe = 0; probe < DECK_CACHE_PROBES; probe++, slot++)
+	{
+		slot %= DECK_CACHE_SIZE;
+		if (cache->cards[slot] == card)
+			return (cache->buckets[slot]);
+		if (!cache->cards[slot])
+		{
+			cache->cards[slot] = card;
+			cache->buckets[slot] = card_bucket(card);
+			return (cache->buckets[slot]);
+		}
+	}
+
+	return (card_bucket(card));
+}
@@ -0,0 +1,94 @@
+#include "deck.h"
+
+static deck_node_t *deck_pool_link(deck_node_t *nodes, size_t count);
+
+/**
+ * deck_pool_build - Creates a deck from an array of cards, with its
+ * nodes taken from a node pool.
+ *
+ * @pool: Pointer to a pool of deck_node_t nodes.
+ * @cards: Array of the cards, in deck order, which must outlive the deck.
+ * @count: Number of cards, 52 for a full deck.
+ *
+ * Description:
+ * As list_pool_build: one contiguous block of nodes, linked in one
+ * pass, and freed with the pool.
+ *
+ * Return: Pointer to the first node of the deck, or NULL if `count` is
+ * 0 or the nodes cannot be allocated.
+ */
+deck_node_t *deck_pool_build(node_pool_t *pool, const card_t *cards,
+			     size_t count)
+{
+	deck_node_t *nodes = node_pool_alloc(pool, count);
+	size_t i;
+
+	if (!nodes)
+		return (NULL);
+
+	for (i = 0; i < count; i++)
+		nodes[i].card = &cards[i];
+
+	return (deck_pool_link(nodes, count));
+}
+
+/**
+ * deck_pool_compact - Moves the nodes of a deck into one contiguous
+ * block, in deck order.
+ *
+ * @pool: Pointer to the pool the deck was built from, which must hold
+ * no other live node.
+ * @deck: Pointer to the head of the deck, updated to the moved nodes.
+ *
+ * Description:
+ * As list_pool_compact: the old slabs are released, so the old node
+ * addresses are invalid afterwards.
+ *
+ * Return: 0 on success, -1 if the new slab cannot be allocated, in
+ * which case the deck and the pool are left as they were.
+ */
+int deck_pool_compact(node_pool_t *pool, deck_node_t **deck)
+{
+	node_pool_t fresh;
+	deck_node_t *node, *nodes;
+	size_t count = 0, i;
+
+	if (!deck || !*deck)
+		return (0);
+
+	for (node = *deck; node; node = node->next)
+		count++;
+	node_pool_init(&fresh, pool->node_size, pool->slab_nodes);
+	nodes = node_pool_alloc(&fresh, count);
+	if (!nodes)
+		return (-1);
+
+	for (i = 0, node = *deck; node; node = node->next, i++)
+		nodes[i].card = node->card;
+
+	node_pool_destroy(pool);
+	*pool = fresh;
+	*deck = deck_pool_link(nodes, count);
+	return (0);
+}
+
+/**
+ * deck_pool_link - Links an array of deck nodes, in array order.
+ *
+ * @nodes: Pointer to the nodes.
+ * @count: Number of nodes, at least 1.
+ *
+ * Return: Pointer to the first node.
+ */
+static deck_node_t *deck_pool_link(deck_node_t *nodes, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		nodes[i].prev = i ? &nodes[i - 1] : NULL;
+		nodes[i].next = i + 1 < count ? &nodes[i + 1] : NULL;
+	}
+
+	return (nodes);
+}
@@ -0,0 +1,58 @@
+#include "deck.h"
+
+/**
+ * card_rank - Parses the value of a card into its rank.
+ *
+ * @value: Value of the card, "Ace", "2" to "10", "Jack", "Queen" or
+ * "King".
+ *
+ * Description:
+ * The first character selects the only name the value can be, so a
+ * card costs at most one _strcmp, or one _atoi for the numbers.
+ *
+ * Return: The rank, 0 for the Ace to 12 for the King, or DECK_RANKS if
+ * `value` is not the value of a card.
+ */
+size_t card_rank(const char *value)
+{
+	static const char *const names[] = {"Ace", "Jack", "Queen", "King"};
+	static const size_t ranks[] = {0, 10, 11, 12};
+	long int number;
+	size_t i;
+
+	if (!value)
+		return (DECK_RANKS);
+
+	for (i = 0; i < sizeof(ranks) / sizeof(*ranks); i++)
+		if (*value == *names[i])
+			break;
+	if (i < sizeof(ranks) / sizeof(*ranks))
+		return (_strcmp(value, names[i]) ? DECK_RANKS : ranks[i]);
+
+	number = _atoi(value);
+	if (number < 2 || number > 10 || value[number == 10 ? 2 : 1])
+		return (DECK_RANKS);
+
+	return (number - 1);
+}
+
+/**
+ * card_bucket - Computes the position of a card in a sorted deck.
+ *
+ * @card: The card.
+ *
+ * Description:
+ * Cards are ordered by suit (Spades < Hearts < Clubs < Diamonds), then
+ * by rank. Unknown values go after the King of their suit, and unknown
+ * suits with the Diamonds.
+ *
+ * Return: The bucket of the card, less than DECK_BUCKETS.
+ */
+size_t card_bucket(const card_t *card)
+{
+	size_t kind = (size_t)card->kind;
+
+	kind = kind < DECK_SUITS ? kind : DECK_SUITS - 1;
+
+	return (kind * (DECK_RANKS + 1) + card_rank(card->value));
+}
@@ -0,0 +1,193 @@
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include "sort.h"
+
+static int external_sort_finish(FILE **runs, size_t count, FILE *output,
+				const external_sort_options_t *config);
+static FILE **external_sort_pass(FILE **runs, size_t *count,
+				 const external_sort_options_t *config);
+static void external_sort_close(FILE **runs, size_t count);
+
+/**
+ * external_sort - Sorts a binary file of native int32 values that may be
+ * larger than the available memory.
+ *
+ * @input: Path of the file to sort.
+ * @output: Path of the sorted file, created or replaced. It may be the
+ * same path as `input`.
+ * @options: Memory budget, fan-in, threads and temporary directory, or
+ * NULL for the defaults.
+ *
+ * Description:
+ * The sorted values are written to a temporary file next to `output`,
+ * which is renamed over `output` only once it is complete and synced.
+ * On any failure the temporary file is removed and `output` is left as
+ * it was, so a file sorted onto itself is never lost.
+ *
+ * Return: 0 on success, -1 with errno set on failure.
+ */
+int external_sort(const char *input, const char *output,
+		  const external_sort_options_t *options)
+{
+	external_sort_options_t config = external_sort_config(options);
+	FILE *in, *out = NULL, **runs;
+	char temp[PATH_MAX];
+	size_t count;
+	int status, error;
+
+	in = fopen(input, "rb");
+	if (!in)
+		return (-1);
+	runs = external_sort_runs(in, NULL, &config, &count);
+	fclose(in);
+	if (runs)
+		out = external_sort_sibling(output, temp, sizeof(temp));
+	if (!out)
+	{
+		if (runs)
+			external_sort_close(runs, count);
+		return (-1);
+	}
+
+	status = external_sort_finish(runs, count, out, &config);
+	if (!status && fsync(fileno(out)))
+		status = -1;
+	if (fclose(out))
+		status = -1;
+	if (!status && rename(temp, output))
+		status = -1;
+	if (status)
+	{
+		error = errno;
+		unlink(temp);
+		errno = error;
+	}
+
+	return (status);
+}
+
+/**
+ * external_sort_file - Sorts a stream of native int32 values with a
+ * bounded amount of memory.
+ *
+ * @input: Stream to sort, read sequentially until its end.
+ * @output: Stream the sorted values are written to.
+ * @options: Memory budget, fan-in, threads and temporary directory, or
+ * NULL for the defaults.
+ *
+ * Description:
+ * The input is read in chunks of half the memory budget (the other
+ * half is the buffer of radix_sort_parallel), and each chunk is sorted
+ * and spilled to an unlinked temporary file; an input that fits in one
+ * chunk is written to `output` directly. The runs are then merged
+ * `fan_in` at a time with a loser tree, in as many passes as needed,
+ * every run being read through its own large buffer so that the I/O
+ * stays sequential.
+ *
+ * Return: 0 on success, -1 with errno set on failure.
+ */
+int external_sort_file(FILE *input, FILE *output,
+		       const external_sort_options_t *options)
+{
+	external_sort_options_t config = external_sort_config(options);
+	FILE **runs;
+	size_t count;
+
+	runs = external_sort_runs(input, output, &config, &count);
+	if (!runs)
+		return (-1);
+
+	return (external_sort_finish(runs, count, output, &config));
+}
+
+/**
+ * external_sort_finish - Merges sorted runs into the output and closes
+ * them.
+ *
+ * @runs: Array of run files, positioned at their start, freed here.
+ * @count: Number of runs, 0 if the output is already written.
+ * @output: Stream the sorted values are written to.
+ * @config: Resolved options of the sort.
+ *
+ * Return: 0 on success, -1 with errno set on failure.
+ */
+static int external_sort_finish(FILE **runs, size_t count, FILE *output,
+				const external_sort_options_t *config)
+{
+	int status;
+
+	while (count > config->fan_in)
+	{
+		runs = external_sort_pass(runs, &count, config);
+		if (!runs)
+			return (-1);
+	}
+
+	status = count ? external_sort_merge(runs, count, output,
+					     config->memory) : 0;
+	external_sort_close(runs, count);
+	if (fflush(output))
+		status = -1;
+
+	return (status);
+}
+
+/**
+ * external_sort_pass - Merges groups of `fan_in` consecutive runs into
+ * new runs.
+ *
+ * @runs: Array of run files, closed and freed here.
+ * @count: Number of runs, updated to the number of new runs.
+ * @config: Resolved options of the sort.
+ *
+ * Return: The array of new runs, or NULL (every run closed) on failure.
+ */
+static FILE **external_sort_pass(FILE **runs, size_t *count,
+				 const external_sort_options_t *config)
+{
+	size_t groups = (*count + config->fan_in - 1) / config->fan_in;
+	size_t i, first, ways;
+	FILE **merged = calloc(groups, sizeof(*merged));
+	int failed = !merged;
+
+	for (i = 0; i < groups && !failed; i++)
+	{
+		first = i * config->fan_in;
+		ways = *count - first < config->fan_in ?
+			*count - first : config->fan_in;
+		merged[i] = external_sort_temp(config->temp_dir);
+		failed = !merged[i] ||
+			external_sort_merge(runs + first, ways, merged[i],
+					    config->memory) ||
+			fflush(merged[i]) || fseek(merged[i], 0, SEEK_SET);
+	}
+
+	external_sort_close(runs, *count);
+	if (failed)
+	{
+		if (merged)
+			external_sort_close(merged, groups);
+		return (NULL);
+	}
+
+	*count = groups;
+	return (merged);
+}
+
+/**
+ * external_sort_close - Closes the files of an array of runs and frees
+ * the array.
+ *
+ * @runs: Array of run files, NULL entries being skipped.
+ * @count: Number of runs.
+ */
+static void external_sort_close(FILE **runs, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+		if (runs[i])
+			fclose(runs[i]);
+	free(runs);
+}
@@ -0,0 +1,123 @@
+#include "sort.h"
+
+static int external_sort_merge_loop(loser_tree_t *tree,
+				    external_sort_stream_t *streams,
+				    FILE *output, int *buffer,
+				    size_t capacity);
+static int64_t external_sort_next(external_sort_stream_t *stream);
+
+/**
+ * external_sort_merge - Merges sorted runs into a stream with a loser
+ * tree.
+ *
+ * @runs: Array of run files, positioned at their start.
+ * @count: Number of runs, at least 1.
+ * @output: Stream the merged values are appended to.
+ * @memory: Memory budget in bytes, shared evenly by the read buffers of
+ * the runs and the write buffer of the output.
+ *
+ * Description:
+ * Every run is read and the output is written in blocks of
+ * memory / (count + 1) bytes, so the I/O stays sequential however many
+ * runs are merged. Equal values are taken from the run with the lowest
+ * index first.
+ *
+ * Return: 0 on success, -1 with errno set on failure.
+ */
+int external_sort_merge(FILE **runs, size_t count, FILE *output,
+			size_t memory)
+{
+	size_t capacity = memory / (sizeof(int) * (count + 1)), i;
+	external_sort_stream_t *streams;
+	loser_tree_t tree;
+	int *buffers, status = -1;
+
+	streams = malloc(sizeof(*streams) * count);
+	buffers = malloc(sizeof(int) * capacity * (count + 1));
+	if (streams && buffers && !loser_tree_init(&tree, count))
+	{
+		for (i = 0; i < count; i++)
+		{
+			streams[i].file = runs[i];
+			streams[i].buffer = buffers + capacity * (i + 1);
+			streams[i].capacity = capacity;
+			streams[i].length = 0;
+			streams[i].position = 0;
+			tree.keys[i] = external_sort_next(&streams[i]);
+		}
+		loser_tree_build(&tree);
+		status = external_sort_merge_loop(&tree, streams, output,
+						  buffers, capacity);
+		for (i = 0; i < count; i++)
+			if (ferror(runs[i]))
+				status = -1;
+		loser_tree_destroy(&tree);
+	}
+
+	free(streams);
+	free(buffers);
+	return (status);
+}
+
+/**
+ * external_sort_merge_loop - Moves the smallest value of the runs to the
+ * output until every run is exhausted.
+ *
+ * @tree: Loser tree holding the current value of every run.
+ * @streams: Array of the readers of the runs.
+ * @output: Stream the merged values are appended to.
+ * @buffer: Write buffer of the output.
+ * @capacity: Number of integers `buffer` can hold.
+ *
+ * Return: 0 on success, -1 with errno set on a write error.
+ */
+static int external_sort_merge_loop(loser_tree_t *tree,
+				    external_sort_stream_t *streams,
+				    FILE *output, int *buffer,
+				    size_t capacity)
+{
+	size_t length = 0, winner;
+
+	while (tree->keys[tree->winner] != LOSER_TREE_DONE)
+	{
+		if (length == capacity)
+		{
+			length = fwrite(buffer, sizeof(int), capacity, output);
+			if (length < capacity)
+				return (-1);
+			length = 0;
+		}
+		winner = tree->winner;
+		buffer[length++] = (int)tree->keys[winner];
+		tree->keys[winner] = external_sort_next(&streams[winner]);
+		loser_tree_replay(tree);
+	}
+
+	if (fwrite(buffer, sizeof(int), length, output) < length)
+		return (-1);
+
+	return (0);
+}
+
+/**
+ * external_sort_next - Reads the next value of a run, refilling its
+ * buffer from the file when it is empty.
+ *
+ * @stream: Reader of the run.
+ *
+ * Return: The next value, or LOSER_TREE_DONE at the end of the run or
+ * on a read error (which the caller checks with ferror).
+ */
+static int64_t external_sort_next(external_sort_stream_t *stream)
+{
+	if (stream->position == stream->length)
+	{
+		stream->length = fread(stream->buffer, sizeof(int),
+				       stream->capacity, stream->file);
+		stream->position = 0;
+		if (!stream->length)
+			return (LOSER_TREE_DONE);
+	}
+
+	return (stream->buffer[stream->position++]);
+}
@@ -0,0 +1,53 @@
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "sort.h"
+
+/**
+ * external_sort_sibling - Creates a temporary file in the directory of
+ * a path, to be renamed over that path once complete.
+ *
+ * @path: Path the file will replace.
+ * @temp: Receives the path of the temporary file.
+ * @size: Size of `temp` in bytes.
+ *
+ * Description:
+ * The file is named after `path` with a random suffix, so rename() can
+ * replace `path` atomically. It gets the permissions of `path` when
+ * that exists, else those fopen() would have given a new file.
+ *
+ * Return: The file, open for writing, or NULL with errno set on failure.
+ */
+FILE *external_sort_sibling(const char *path, char *temp, size_t size)
+{
+	struct stat info;
+	mode_t mask;
+	FILE *file;
+	int fd;
+
+	if ((size_t)snprintf(temp, size, "%s.sort-XXXXXX", path) >= size)
+	{
+		errno = ENAMETOOLONG;
+		return (NULL);
+	}
+
+	fd = mkstemp(temp);
+	if (fd < 0)
+		return (NULL);
+	if (stat(path, &info))
+	{
+		mask = umask(0);
+		umask(mask);
+		info.st_mode = 0666 & ~mask;
+	}
+
+	file = fchmod(fd, info.st_mode & 07777) ? NULL : fdopen(fd, "wb");
+	if (!file)
+	{
+		close(fd);
+		unlink(temp);
+	}
+
+	return (file);
+}
@@ -0,0 +1,216 @@
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include "sort.h"
+
+static int external_sort_read(FILE *input, int *chunk, size_t length,
+			      size_t *count);
+static int external_sort_spill(FILE ***runs, size_t *count, const int *chunk,
+			       size_t length, const char *dir);
+
+/**
+ * external_sort_config - Resolves the options of an external sort.
+ *
+ * @options: Options given by the caller, or NULL for the defaults.
+ *
+ * Description:
+ * Zero fields take their default. The memory budget is raised so that
+ * a 2-way merge fits, and the fan-in is capped so that every merged
+ * run and the output get a buffer of at least EXTERNAL_SORT_MIN_BUFFER
+ * integers: a larger fan-in would save a pass but make the reads too
+ * small to stay sequential.
+ *
+ * Return: The resolved options.
+ */
+external_sort_options_t
+external_sort_config(const external_sort_options_t *options)
+{
+	external_sort_options_t config = {0, 0, 0, NULL};
+	size_t least = sizeof(int) * EXTERNAL_SORT_MIN_BUFFER * 3, most;
+
+	if (options)
+		config = *options;
+	if (!config.memory)
+		config.memory = EXTERNAL_SORT_MEMORY;
+	config.memory = config.memory > least ? config.memory : least;
+	if (!config.fan_in)
+		config.fan_in = EXTERNAL_SORT_FAN_IN;
+
+	most = config.memory / (sizeof(int) * EXTERNAL_SORT_MIN_BUFFER) - 1;
+	config.fan_in = config.fan_in < most ? config.fan_in : most;
+	config.fan_in = config.fan_in > 2 ? config.fan_in : 2;
+
+	if (!config.temp_dir || !*config.temp_dir)
+		config.temp_dir = getenv("TMPDIR");
+	if (!config.temp_dir || !*config.temp_dir)
+		config.temp_dir = "/tmp";
+
+	return (config);
+}
+
+/**
+ * external_sort_temp - Creates an anonymous temporary file.
+ *
+ * @dir: Directory of the file.
+ *
+ * Description:
+ * The file is unlinked as soon as it is created, so it never outlives
+ * the process, even when the sort is interrupted.
+ *
+ * Return: The file, open for update, or NULL with errno set on failure.
+ */
+FILE *external_sort_temp(const char *dir)
+{
+	char path[PATH_MAX];
+	FILE *file;
+	int fd;
+
+	if ((size_t)snprintf(path, sizeof(path), "%s/sort-XXXXXX", dir) >=
+	    sizeof(path))
+	{
+		errno = ENAMETOOLONG;
+		return (NULL);
+	}
+
+	fd = mkstemp(path);
+	if (fd < 0)
+		return (NULL);
+	unlink(path);
+
+	file = fdopen(fd, "w+b");
+	if (!file)
+		close(fd);
+
+	return (file);
+}
+
+/**
+ * external_sort_runs - Splits a stream of int32 values into sorted runs.
+ *
+ * @input: Stream to split, read until its end.
+ * @output: Stream the values are sorted into when they all fit in
+ * memory, or NULL to always spill them.
+ * @config: Resolved options of the sort.
+ * @count: Set to the number of runs, 0 if `output` was written.
+ *
+ * Description:
+ * The memory budget is allocated up front, half for the chunk and half
+ * for the buffer of the radix sort, so once the run phase has started
+ * every chunk is sorted without further allocation.
+ *
+ * Return: The array of run files, positioned at their start, or NULL
+ * with errno set on failure.
+ */
+FILE **external_sort_runs(FILE *input, FILE *output,
+			  const external_sort_options_t *config,
+			  size_t *count)
+{
+	size_t length = config->memory / (sizeof(int) * 2), read;
+	int *chunk = malloc(sizeof(int) * length * 2), status = -1;
+	FILE **runs = malloc(sizeof(*runs) * 16);
+
+	*count = 0;
+	while (chunk && runs && !external_sort_read(input, chunk, length,
+						     &read))
+	{
+		if (!read && *count)
+		{
+			status = 0;
+			break;
+		}
+		radix_sort_parallel(chunk, read, chunk + length,
+				    config->threads);
+		if (output && !*count && read < length)
+		{
+			if (fwrite(chunk, sizeof(int), read, output) == read)
+				status = 0;
+			break;
+		}
+		if (external_sort_spill(&runs, count, chunk, read,
+					config->temp_dir))
+			break;
+		if (read < length)
+		{
+			status = 0;
+			break;
+		}
+	}
+
+	free(chunk);
+	if (status)
+	{
+		while (runs && *count)
+			fclose(runs[--*count]);
+		free(runs);
+		return (NULL);
+	}
+
+	return (runs);
+}
+
+/**
+ * external_sort_read - Reads the next chunk of a stream of int32 values.
+ *
+ * @input: Stream to read.
+ * @chunk: Buffer receiving the values.
+ * @length: Number of values `chunk` can hold.
+ * @count: Set to the number of values read, less than `length` only at
+ * the end of the stream.
+ *
+ * Return: 0 on success, -1 with errno set on a read error or if the
+ * stream does not hold a whole number of values.
+ */
+static int external_sort_read(FILE *input, int *chunk, size_t length,
+			      size_t *count)
+{
+	size_t bytes = fread(chunk, 1, sizeof(int) * length, input);
+
+	*count = bytes / sizeof(int);
+	if (ferror(input))
+		return (-1);
+	if (bytes % sizeof(int))
+	{
+		errno = EINVAL;
+		return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * external_sort_spill - Writes a sorted run to a temporary file and
+ * appends the file to the array of runs.
+ *
+ * @runs: Pointer to the array of runs, which has room for 16 runs or
+ * for the next power of 2, and is grown when it is full.
+ * @count: Pointer to the number of runs, incremented on success.
+ * @chunk: Sorted values of the run.
+ * @length: Number of values of the run.
+ * @dir: Directory of the file.
+ *
+ * Return: 0 on success, -1 with errno set on failure.
+ */
+static int external_sort_spill(FILE ***runs, size_t *count, const int *chunk,
+			       size_t length, const char *dir)
+{
+	FILE **grown = *runs, *run;
+
+	if (*count >= 16 && !(*count & (*count - 1)))
+		grown = realloc(*runs, sizeof(**runs) * *count * 2);
+	if (!grown)
+		return (-1);
+	*runs = grown;
+
+	run = external_sort_temp(dir);
+	if (!run)
+		return (-1);
+	if (fwrite(chunk, sizeof(int), length, run) < length ||
+	    fflush(run) || fseek(run, 0, SEEK_SET))
+	{
+		fclose(run);
+		return (-1);
+	}
+
+	grown[(*count)++] = run;
+	return (0);
+}
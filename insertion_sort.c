@@ -0,0 +1,33 @@
+#include "sort.h"
+
+/**
+ * insertion_sort - Sorts an array of integers in ascending order using
+ * the Insertion Sort algorithm.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Size of the array.
+ *
+ * Description:
+ * Each element is shifted left into place rather than swapped, which
+ * makes this the cheapest way to finish the small sub-arrays left over
+ * by the divide and conquer sorts. It never traces its steps.
+ *
+ * Note:
+ * - The input array must be a valid array of integers.
+ */
+void insertion_sort(int *array, size_t size)
+{
+	size_t i, j;
+	int value;
+
+	if (!array || size < 2)
+		return;
+
+	for (i = 1; i < size; i++)
+	{
+		value = array[i];
+		for (j = i; j > 0 && array[j - 1] > value; j--)
+			array[j] = array[j - 1];
+		array[j] = value;
+	}
+}
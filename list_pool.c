@@ -0,0 +1,97 @@
+#include "sort.h"
+
+static listint_t *list_pool_link(listint_t *nodes, size_t size);
+
+/**
+ * list_pool_build - Creates a doubly linked list from an array of
+ * integers, with its nodes taken from a node pool.
+ *
+ * @pool: Pointer to a pool of listint_t nodes.
+ * @array: Array to convert to a doubly linked list.
+ * @size: Size of the array.
+ *
+ * Description:
+ * Unlike create_listint, which calls malloc once per node, the nodes
+ * are taken as one contiguous block and linked in a single forward
+ * pass, so the list is laid out in memory in its own order. The list
+ * is freed with the pool, by node_pool_destroy.
+ *
+ * Return: Pointer to the first element of the list, or NULL if `size`
+ * is 0 or the nodes cannot be allocated.
+ */
+listint_t *list_pool_build(node_pool_t *pool, const int *array, size_t size)
+{
+	listint_t *nodes = node_pool_alloc(pool, size);
+	size_t i;
+
+	if (!nodes)
+		return (NULL);
+
+	for (i = 0; i < size; i++)
+		*(int *)&nodes[i].n = array[i];
+
+	return (list_pool_link(nodes, size));
+}
+
+/**
+ * list_pool_compact - Moves the nodes of a list into one contiguous
+ * block, in list order.
+ *
+ * @pool: Pointer to the pool the list was built from, which must hold
+ * no other live node.
+ * @list: Pointer to the head of the list, updated to the moved nodes.
+ *
+ * Description:
+ * After a sort the nodes are still where they were allocated, so a
+ * traversal jumps around memory. The nodes are copied in list order
+ * into a fresh slab and every slab they came from is released: later
+ * traversals are sequential, and the old node addresses are invalid.
+ *
+ * Return: 0 on success, -1 if the new slab cannot be allocated, in
+ * which case the list and the pool are left as they were.
+ */
+int list_pool_compact(node_pool_t *pool, listint_t **list)
+{
+	node_pool_t fresh;
+	listint_t *node, *nodes;
+	size_t size = 0, i;
+
+	if (!list || !*list)
+		return (0);
+
+	for (node = *list; node; node = node->next)
+		size++;
+	node_pool_init(&fresh, pool->node_size, pool->slab_nodes);
+	nodes = node_pool_alloc(&fresh, size);
+	if (!nodes)
+		return (-1);
+
+	for (i = 0, node = *list; node; node = node->next, i++)
+		memcpy(&nodes[i], node, sizeof(*node));
+
+	node_pool_destroy(pool);
+	*pool = fresh;
+	*list = list_pool_link(nodes, size);
+	return (0);
+}
+
+/**
+ * list_pool_link - Links an array of nodes into a list, in array order.
+ *
+ * @nodes: Pointer to the nodes.
+ * @size: Number of nodes, at least 1.
+ *
+ * Return: Pointer to the first node.
+ */
+static listint_t *list_pool_link(listint_t *nodes, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		nodes[i].prev = i ? &nodes[i - 1] : NULL;
+		nodes[i].next = i + 1 < size ? &nodes[i + 1] : NULL;
+	}
+
+	return (nodes);
+}
@@ -0,0 +1,121 @@
+#include "sort.h"
+
+/* Whether source a wins against source b: smaller key, then lower index */
+#define LOSER_TREE_BEATS(keys, a, b)				\
+	(((keys)[a] < (keys)[b]) | (((keys)[a] == (keys)[b]) & ((a) < (b))))
+
+static size_t loser_tree_node(loser_tree_t *tree, size_t node);
+
+/**
+ * loser_tree_init - Allocates a loser tree with every source exhausted.
+ *
+ * @tree: Pointer to the tree to initialize.
+ * @ways: Number of sources, at least 1.
+ *
+ * Description:
+ * The caller stores the first key of every source in tree->keys, then
+ * calls loser_tree_build.
+ *
+ * Return: 0 on success, -1 if the tree cannot be allocated.
+ */
+int loser_tree_init(loser_tree_t *tree, size_t ways)
+{
+	size_t i;
+
+	tree->ways = ways;
+	tree->winner = 0;
+	tree->losers = malloc(sizeof(*tree->losers) * ways);
+	tree->keys = malloc(sizeof(*tree->keys) * ways);
+	if (!ways || !tree->losers || !tree->keys)
+	{
+		loser_tree_destroy(tree);
+		return (-1);
+	}
+
+	for (i = 0; i < ways; i++)
+		tree->keys[i] = LOSER_TREE_DONE;
+
+	return (0);
+}
+
+/**
+ * loser_tree_destroy - Frees the memory of a loser tree.
+ *
+ * @tree: Pointer to the tree.
+ */
+void loser_tree_destroy(loser_tree_t *tree)
+{
+	free(tree->losers);
+	free(tree->keys);
+	tree->losers = NULL;
+	tree->keys = NULL;
+}
+
+/**
+ * loser_tree_build - Plays every match of the tree from the current keys.
+ *
+ * @tree: Pointer to the tree.
+ *
+ * Description:
+ * Source i is the leaf at node ways + i, so the tree is complete for
+ * any number of sources. Building costs ways - 1 comparisons.
+ */
+void loser_tree_build(loser_tree_t *tree)
+{
+	tree->winner = loser_tree_node(tree, 1);
+}
+
+/**
+ * loser_tree_replay - Finds the new winner after the key of the current
+ * winner has changed.
+ *
+ * @tree: Pointer to the tree.
+ *
+ * Description:
+ * Only the matches on the path from the winner's leaf to the root are
+ * replayed, against the losers stored there: log2(ways) comparisons,
+ * and unlike a heap no sibling has to be read.
+ */
+void loser_tree_replay(loser_tree_t *tree)
+{
+	size_t winner = tree->winner, node, loser, swap;
+
+	/* Masks rather than branches: on merged data they mispredict */
+	for (node = (tree->ways + winner) / 2; node; node /= 2)
+	{
+		loser = tree->losers[node];
+		swap = (loser ^ winner) &
+			-(size_t)LOSER_TREE_BEATS(tree->keys, loser, winner);
+		tree->losers[node] = loser ^ swap;
+		winner ^= swap;
+	}
+
+	tree->winner = winner;
+}
+
+/**
+ * loser_tree_node - Plays the matches of a subtree.
+ *
+ * @tree: Pointer to the tree.
+ * @node: Root of the subtree.
+ *
+ * Return: The source winning the subtree.
+ */
+static size_t loser_tree_node(loser_tree_t *tree, size_t node)
+{
+	size_t left, right;
+
+	if (node >= tree->ways)
+		return (node - tree->ways);
+
+	left = loser_tree_node(tree, 2 * node);
+	right = loser_tree_node(tree, 2 * node + 1);
+	if (LOSER_TREE_BEATS(tree->keys, right, left))
+	{
+		tree->losers[node] = left;
+		return (right);
+	}
+
+	tree->losers[node] = right;
+	return (left);
+}
@@ -0,0 +1,190 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include "sort.h"
+
+static int mmap_sort_open(const char *path, size_t *bytes);
+static void mmap_sort_mapping(int *array, size_t size,
+			      const mmap_sort_options_t *options);
+static size_t mmap_sort_resident(void *address, size_t length);
+static void mmap_sort_faults(long *minor, long *major, int sign);
+
+/**
+ * mmap_sort - Sorts a binary file of native int32 values in place
+ * through a shared memory mapping.
+ *
+ * @path: Path of the file to sort.
+ * @options: Sort, threads, huge pages and write-back, or NULL for the
+ * defaults.
+ * @stats: Filled with the size, page cache residency and page faults
+ * of the sort, or NULL.
+ *
+ * Description:
+ * The file is mapped MAP_SHARED and sorted where it lies: there is no
+ * read() or write() copy and no buffer the size of the file, the page
+ * cache being the only memory used. It fits files that fit in RAM;
+ * larger ones should go through external_sort instead, whose I/O
+ * stays sequential.
+ *
+ * Return: 0 on success, -1 with errno set on failure.
+ */
+int mmap_sort(const char *path, const mmap_sort_options_t *options,
+	      mmap_sort_stats_t *stats)
+{
+	mmap_sort_options_t config = {NULL, 0, 0, 0};
+	mmap_sort_stats_t local;
+	void *mapping;
+	int fd;
+
+	stats = stats ? stats : &local;
+	memset(stats, 0, sizeof(*stats));
+	if (options)
+		config = *options;
+	fd = mmap_sort_open(path, &stats->bytes);
+	if (fd < 0)
+		return (-1);
+
+	mapping = stats->bytes ? mmap(NULL, stats->bytes, PROT_READ |
+				      PROT_WRITE, MAP_SHARED, fd, 0) : NULL;
+	close(fd);
+	if (mapping == MAP_FAILED)
+		return (-1);
+	if (!mapping)
+		return (0);
+
+	stats->resident_before = mmap_sort_resident(mapping, stats->bytes);
+	mmap_sort_faults(&stats->minor_faults, &stats->major_faults, -1);
+	mmap_sort_mapping(mapping, stats->bytes / sizeof(int), &config);
+	mmap_sort_faults(&stats->minor_faults, &stats->major_faults, 1);
+	stats->resident_after = mmap_sort_resident(mapping, stats->bytes);
+
+	if (config.sync && msync(mapping, stats->bytes, MS_SYNC))
+	{
+		munmap(mapping, stats->bytes);
+		return (-1);
+	}
+
+	return (munmap(mapping, stats->bytes));
+}
+
+/**
+ * mmap_sort_open - Opens a file of int32 values for update.
+ *
+ * @path: Path of the file.
+ * @bytes: Set to the size of the file.
+ *
+ * Return: The file descriptor, or -1 with errno set on failure or if
+ * the file does not hold a whole number of values.
+ */
+static int mmap_sort_open(const char *path, size_t *bytes)
+{
+	struct stat info;
+	int fd = open(path, O_RDWR);
+
+	if (fd < 0)
+		return (-1);
+	if (fstat(fd, &info))
+	{
+		close(fd);
+		return (-1);
+	}
+	if (info.st_size % sizeof(int))
+	{
+		close(fd);
+		errno = EINVAL;
+		return (-1);
+	}
+
+	*bytes = info.st_size;
+	return (fd);
+}
+
+/**
+ * mmap_sort_mapping - Sorts a mapped file with the access hint of each
+ * phase.
+ *
+ * @array: Start of the mapping.
+ * @size: Number of integers of the mapping.
+ * @options: Resolved options of the sort.
+ *
+ * Description:
+ * The file is first read ahead in one sequential sweep, so the sort
+ * does not fault page by page. During the sort the hint is switched to
+ * random, since the partitions of every thread would otherwise trigger
+ * read-ahead around pages that are already resident. Huge pages are
+ * only a request: the kernel honours them for the file systems that
+ * support them (e.g. tmpfs mounted with huge=) and ignores them
+ * elsewhere.
+ */
+static void mmap_sort_mapping(int *array, size_t size,
+			      const mmap_sort_options_t *options)
+{
+	size_t length = size * sizeof(int);
+
+#ifdef MADV_HUGEPAGE
+	if (options->huge_pages)
+		madvise(array, length, MADV_HUGEPAGE);
+#endif
+	madvise(array, length, MADV_SEQUENTIAL);
+	madvise(array, length, MADV_WILLNEED);
+
+	madvise(array, length, MADV_RANDOM);
+	if (options->sort)
+		options->sort(array, size);
+	else
+		quick_sort_parallel(array, size, options->threads, 0);
+
+	/* The write-back, if any, walks the file in order */
+	madvise(array, length, MADV_SEQUENTIAL);
+}
+
+/**
+ * mmap_sort_resident - Counts the bytes of a mapping that are in memory.
+ *
+ * @address: Start of the mapping, page aligned.
+ * @length: Length of the mapping in bytes.
+ *
+ * Return: The number of bytes of the resident pages.
+ */
+static size_t mmap_sort_resident(void *address, size_t length)
+{
+	unsigned char pages[4096];
+	size_t page = sysconf(_SC_PAGESIZE), offset, span, count, i;
+	size_t resident = 0;
+
+	/* mincore reports one byte per page, queried 4096 pages at a time */
+	for (offset = 0; offset < length; offset += span)
+	{
+		span = length - offset < page * sizeof(pages) ?
+			length - offset : page * sizeof(pages);
+		if (mincore((char *)address + offset, span, pages))
+			return (resident);
+		count = (span + page - 1) / page;
+		for (i = 0; i < count; i++)
+			resident += (pages[i] & 1) * page;
+	}
+
+	return (resident < length ? resident : length);
+}
+
+/**
+ * mmap_sort_faults - Adds the page fault counters of the process to two
+ * totals.
+ *
+ * @minor: Total of the faults served without I/O.
+ * @major: Total of the faults that read from disk.
+ * @sign: -1 before the measured code and 1 after it, so the totals end
+ * up holding the difference.
+ */
+static void mmap_sort_faults(long *minor, long *major, int sign)
+{
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage))
+		return;
+	*minor += sign * usage.ru_minflt;
+	*major += sign * usage.ru_majflt;
+}
@@ -0,0 +1,83 @@
+#include "sort.h"
+
+/**
+ * node_pool_init - Initializes an empty node pool.
+ *
+ * @pool: Pointer to the pool to initialize.
+ * @node_size: Size in bytes of one node, e.g. sizeof(listint_t).
+ * @slab_nodes: Number of nodes of a slab, 0 for as many as fit in
+ * NODE_POOL_SLAB_BYTES.
+ *
+ * Description:
+ * No memory is allocated until the first node is requested.
+ */
+void node_pool_init(node_pool_t *pool, size_t node_size, size_t slab_nodes)
+{
+	pool->node_size = node_size ? node_size : 1;
+	pool->slab_nodes = slab_nodes ? slab_nodes :
+		NODE_POOL_SLAB_BYTES / pool->node_size;
+	pool->slab_nodes = pool->slab_nodes ? pool->slab_nodes : 1;
+	pool->slabs = NULL;
+}
+
+/**
+ * node_pool_alloc - Takes contiguous nodes from a node pool.
+ *
+ * @pool: Pointer to the pool.
+ * @count: Number of nodes, at least 1.
+ *
+ * Description:
+ * The nodes are taken from the current slab when they fit in what is
+ * left of it; otherwise a new slab of max(count, slab_nodes) nodes is
+ * started, so a whole list can always be laid out in one block. The
+ * nodes are uninitialized.
+ *
+ * Return: Pointer to the first node, or NULL if `count` is 0 or a slab
+ * cannot be allocated.
+ */
+void *node_pool_alloc(node_pool_t *pool, size_t count)
+{
+	node_slab_t *slab = pool->slabs;
+	size_t capacity;
+
+	if (!count)
+		return (NULL);
+
+	if (!slab || slab->capacity - slab->used < count)
+	{
+		capacity = count > pool->slab_nodes ? count : pool->slab_nodes;
+		if (capacity > (SIZE_MAX - sizeof(*slab)) / pool->node_size)
+			return (NULL);
+		slab = malloc(sizeof(*slab) + pool->node_size * capacity);
+		if (!slab)
+			return (NULL);
+		slab->next = pool->slabs;
+		slab->used = 0;
+		slab->capacity = capacity;
+		pool->slabs = slab;
+	}
+
+	slab->used += count;
+	return ((char *)(slab + 1) + pool->node_size * (slab->used - count));
+}
+
+/**
+ * node_pool_destroy - Frees every node of a node pool at once.
+ *
+ * @pool: Pointer to the pool, left empty and reusable.
+ *
+ * Description:
+ * The cost is one free() per slab whatever the number of nodes, and
+ * the lists built from the pool must not be used afterwards.
+ */
+void node_pool_destroy(node_pool_t *pool)
+{
+	node_slab_t *slab, *next;
+
+	for (slab = pool->slabs; slab; slab = next)
+	{
+		next = slab->next;
+		free(slab);
+	}
+	pool->slabs = NULL;
+}
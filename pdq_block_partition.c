@@ -0,0 +1,160 @@
+#include "sort.h"
+
+static size_t fill_offsets_left(const int *first, size_t count, int pivot,
+				unsigned char *offsets);
+static size_t fill_offsets_right(const int *last, size_t count, int pivot,
+				 unsigned char *offsets);
+static void swap_offsets(int *base_l, int *base_r,
+			 const unsigned char *offsets_l,
+			 const unsigned char *offsets_r, size_t num,
+			 int use_swaps);
+
+/**
+ * pdq_block_partition - Partitions [first, last) around a pivot without
+ * data dependent branches (BlockQuicksort).
+ *
+ * @array: Pointer to the first element of the array.
+ * @first: Index of the first element to partition.
+ * @last: Index of the last element + 1 (exclusive) to partition.
+ * @pivot: Value to partition around.
+ *
+ * Description:
+ * Blocks of up to PDQ_BLOCK_SIZE elements are scanned from both ends and
+ * the offsets of the misplaced elements are recorded without branching
+ * on the comparisons. The recorded elements are then swapped pairwise,
+ * so the comparisons never cause branch mispredictions.
+ *
+ * Return: Index of the first element greater or equal to the pivot.
+ */
+size_t pdq_block_partition(int *array, size_t first, size_t last, int pivot)
+{
+	unsigned char offsets_l[PDQ_BLOCK_SIZE], offsets_r[PDQ_BLOCK_SIZE];
+	int *left = array + first, *right = array + last;
+	int *base_l = left, *base_r = right;
+	size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0, num, split;
+
+	while (left < right)
+	{
+		split = num_l ? 0 : num_r ? right - left : (right - left) / 2;
+		split = split < PDQ_BLOCK_SIZE ? split : PDQ_BLOCK_SIZE;
+		num_l += fill_offsets_left(left, split, pivot, offsets_l);
+		left += split;
+
+		split = num_r ? 0 : right - left;
+		split = split < PDQ_BLOCK_SIZE ? split : PDQ_BLOCK_SIZE;
+		num_r += fill_offsets_right(right, split, pivot, offsets_r);
+		right -= split;
+
+		num = num_l < num_r ? num_l : num_r;
+		swap_offsets(base_l, base_r, offsets_l + start_l,
+			     offsets_r + start_r, num, num_l == num_r);
+		num_l -= num, num_r -= num, start_l += num, start_r += num;
+		if (num_l == 0)
+			start_l = 0, base_l = left;
+		if (num_r == 0)
+			start_r = 0, base_r = right;
+	}
+
+	while (num_l--)
+		swap(base_l + offsets_l[start_l + num_l], --right), left = right;
+	while (num_r--)
+		swap(base_r - offsets_r[start_r + num_r], left++), right = left;
+
+	return (left - array);
+}
+
+/**
+ * fill_offsets_left - Records the elements of a left block that belong
+ * to the right side.
+ *
+ * @first: Pointer to the first element of the block.
+ * @count: Number of elements in the block.
+ * @pivot: Value to partition around.
+ * @offsets: Receives the offsets of the misplaced elements from `first`.
+ *
+ * Return: The number of misplaced elements found.
+ */
+static size_t fill_offsets_left(const int *first, size_t count, int pivot,
+				unsigned char *offsets)
+{
+	size_t i, found = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		offsets[found] = (unsigned char)i;
+		found += !(first[i] < pivot);
+	}
+
+	return (found);
+}
+
+/**
+ * fill_offsets_right - Records the elements of a right block that belong
+ * to the left side.
+ *
+ * @last: Pointer one past the last element of the block.
+ * @count: Number of elements in the block.
+ * @pivot: Value to partition around.
+ * @offsets: Receives the offsets of the misplaced elements from `last`.
+ *
+ * Return: The number of misplaced elements found.
+ */
+static size_t fill_offsets_right(const int *last, size_t count, int pivot,
+				 unsigned char *offsets)
+{
+	size_t i, found = 0;
+
+	for (i = 1; i <= count; i++)
+	{
+		offsets[found] = (unsigned char)i;
+		found += last[-(long)i] < pivot;
+	}
+
+	return (found);
+}
+
+/**
+ * swap_offsets - Exchanges the misplaced elements of two blocks.
+ *
+ * @base_l: Pointer the left offsets are relative to.
+ * @base_r: Pointer the right offsets are relative to (counting back).
+ * @offsets_l: Offsets of the misplaced elements of the left block.
+ * @offsets_r: Offsets of the misplaced elements of the right block.
+ * @num: Number of pairs to exchange.
+ * @use_swaps: Use plain swaps, needed to stay linear on descending input.
+ *
+ * Description:
+ * Unless `use_swaps` is set, the exchange is done as a single cyclic
+ * rotation, which needs one move per element instead of three.
+ */
+static void swap_offsets(int *base_l, int *base_r,
+			 const unsigned char *offsets_l,
+			 const unsigned char *offsets_r, size_t num,
+			 int use_swaps)
+{
+	size_t i;
+	int *l, *r, tmp;
+
+	if (use_swaps)
+	{
+		for (i = 0; i < num; i++)
+			swap(base_l + offsets_l[i], base_r - offsets_r[i]);
+		return;
+	}
+
+	if (num == 0)
+		return;
+
+	l = base_l + offsets_l[0];
+	r = base_r - offsets_r[0];
+	tmp = *l;
+	*l = *r;
+	for (i = 1; i < num; i++)
+	{
+		l = base_l + offsets_l[i];
+		*r = *l;
+		r = base_r - offsets_r[i];
+		*l = *r;
+	}
+	*r = tmp;
+}
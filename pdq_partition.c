@@ -0,0 +1,188 @@
+#include "sort.h"
+
+static void sort3(int *array, size_t a, size_t b, size_t c);
+
+/**
+ * pdq_partition_right - Partitions a sub-array around array[begin],
+ * putting the elements equal to the pivot on the right side.
+ *
+ * @array: Pointer to the first element of the array.
+ * @begin: Index of the pivot, the first element of the sub-array.
+ * @end: Index of the last element + 1 (exclusive) of the sub-array.
+ * @already_partitioned: Set to 1 if no element had to be moved.
+ *
+ * Description:
+ * The leading elements already smaller than the pivot and the trailing
+ * elements already greater or equal are skipped with plain scans; if
+ * the scans meet, the range was already partitioned. What is left is
+ * handed to the branchless pdq_block_partition.
+ *
+ * Note:
+ * - Some element after `begin` must be greater or equal to the pivot.
+ *
+ * Return: The final index of the pivot.
+ */
+size_t pdq_partition_right(int *array, size_t begin, size_t end,
+			   int *already_partitioned)
+{
+	int pivot = array[begin];
+	size_t first = begin, last = end, pivot_pos;
+
+	while (array[++first] < pivot)
+		;
+
+	if (first - 1 == begin)
+		while (first < last && !(array[--last] < pivot))
+			;
+	else
+		while (!(array[--last] < pivot))
+			;
+
+	*already_partitioned = first >= last;
+	if (!*already_partitioned)
+	{
+		swap(&array[first], &array[last]);
+		first = pdq_block_partition(array, first + 1, last, pivot);
+	}
+
+	pivot_pos = first - 1;
+	array[begin] = array[pivot_pos];
+	array[pivot_pos] = pivot;
+
+	return (pivot_pos);
+}
+
+/**
+ * pdq_partition_left - Partitions a sub-array around array[begin],
+ * putting the elements equal to the pivot on the left side.
+ *
+ * @array: Pointer to the first element of the array.
+ * @begin: Index of the pivot, the first element of the sub-array.
+ * @end: Index of the last element + 1 (exclusive) of the sub-array.
+ *
+ * Description:
+ * Used when the pivot equals the element preceding the sub-array: the
+ * whole left side is then equal to the pivot and never needs sorting,
+ * which makes inputs with few distinct keys run in linear time.
+ *
+ * Return: The final index of the pivot.
+ */
+size_t pdq_partition_left(int *array, size_t begin, size_t end)
+{
+	int pivot = array[begin];
+	size_t first = begin, last = end;
+
+	while (pivot < array[--last])
+		;
+
+	if (last + 1 == end)
+		while (first < last && !(pivot < array[++first]))
+			;
+	else
+		while (!(pivot < array[++first]))
+			;
+
+	while (first < last)
+	{
+		swap(&array[first], &array[last]);
+		while (pivot < array[--last])
+			;
+		while (!(pivot < array[++first]))
+			;
+	}
+
+	array[begin] = array[last];
+	array[last] = pivot;
+
+	return (last);
+}
+
+/**
+ * pdq_partial_insertion_sort - Attempts to insertion sort a sub-array.
+ *
+ * @array: Pointer to the first element of the array.
+ * @begin: Index of the first element of the sub-array.
+ * @end: Index of the last element + 1 (exclusive) of the sub-array.
+ *
+ * Description:
+ * Gives up as soon as more than PDQ_PARTIAL_INSERTION_LIMIT elements
+ * have been moved, so a sub-array that only looked sorted costs O(n).
+ *
+ * Return: 1 if the sub-array is now sorted, 0 if the sort gave up.
+ */
+int pdq_partial_insertion_sort(int *array, size_t begin, size_t end)
+{
+	size_t cur, sift, moved = 0;
+	int value;
+
+	if (end - begin < 2)
+		return (1);
+
+	for (cur = begin + 1; cur < end; cur++)
+	{
+		if (array[cur] < array[cur - 1])
+		{
+			value = array[cur];
+			sift = cur;
+			do {
+				array[sift] = array[sift - 1];
+				sift--;
+			} while (sift != begin && value < array[sift - 1]);
+			array[sift] = value;
+			moved += cur - sift;
+		}
+
+		if (moved > PDQ_PARTIAL_INSERTION_LIMIT)
+			return (0);
+	}
+
+	return (1);
+}
+
+/**
+ * pdq_choose_pivot - Moves the chosen pivot to the start of a sub-array.
+ *
+ * @array: Pointer to the first element of the array.
+ * @begin: Index of the first element of the sub-array.
+ * @end: Index of the last element + 1 (exclusive) of the sub-array.
+ *
+ * Description:
+ * Large sub-arrays use a pseudo-median of nine, small ones a median of
+ * three. Either way the sampled elements are left sorted, so
+ * array[end - 1] >= pivot acts as a sentinel for the partition scans.
+ */
+void pdq_choose_pivot(int *array, size_t begin, size_t end)
+{
+	size_t half = (end - begin) / 2;
+
+	if (end - begin > PDQ_NINTHER_THRESHOLD)
+	{
+		sort3(array, begin, begin + half, end - 1);
+		sort3(array, begin + 1, begin + half - 1, end - 2);
+		sort3(array, begin + 2, begin + half + 1, end - 3);
+		sort3(array, begin + half - 1, begin + half, begin + half + 1);
+		swap(&array[begin], &array[begin + half]);
+	}
+	else
+	{
+		sort3(array, begin + half, begin, end - 1);
+	}
+}
+
+/**
+ * sort3 - Sorts three elements of an array in place.
+ *
+ * @array: Pointer to the first element of the array.
+ * @a: Index that receives the smallest value.
+ * @b: Index that receives the median value.
+ * @c: Index that receives the largest value.
+ */
+static void sort3(int *array, size_t a, size_t b, size_t c)
+{
+	if (array[b] < array[a])
+		swap(&array[a], &array[b]);
+	if (array[c] < array[b])
+		swap(&array[b], &array[c]);
+	if (array[b] < array[a])
+		swap(&array[a], &array[b]);
+}
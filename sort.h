@@ -3,10 +3,74 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdint.h>
 
 #define UP 1
 #define DOWN 0
 
+#define INTROSORT_THRESHOLD 16
+#define INTROSORT_NINTHER_THRESHOLD 128
+
+#define PDQ_INSERTION_THRESHOLD 24
+#define PDQ_NINTHER_THRESHOLD 128
+#define PDQ_PARTIAL_INSERTION_LIMIT 8
+#define PDQ_BLOCK_SIZE 64
+
+#define TIM_SORT_MIN_MERGE 64
+#define TIM_SORT_MIN_GALLOP 7
+#define TIM_SORT_MAX_RUNS 85
+
+#define MERGE_BASE_BLOCK 8
+
+#define RADIX_PASSES 4
+#define RADIX_BUCKETS 256
+#define RADIX_KEY(value) ((unsigned int)(value) ^ 0x80000000u)
+#define RADIX_DIGIT(value, pass) ((RADIX_KEY(value) >> ((pass) * 8)) & 0xff)
+#define RADIX_MSD_THRESHOLD 128
+#define RADIX_PARALLEL_THRESHOLD 65536
+
+/* Order-preserving unsigned keys of int64_t and of float/double bits */
+#define RADIX_KEY_I64(value) ((uint64_t)(value) ^ ((uint64_t)1 << 63))
+#define RADIX_KEY_FLOAT(bits) \
+	((bits) ^ (-((bits) >> 31) | (uint32_t)1 << 31))
+#define RADIX_KEY_DOUBLE(bits) \
+	((bits) ^ (-((bits) >> 63) | (uint64_t)1 << 63))
+
+#define TYPED_INSERTION_THRESHOLD 16
+#define RADIX_LIST_THRESHOLD 64
+
+#define SMALL_SORT_MAX 64
+
+#define SORT_MAX_THREADS 256
+#define SORT_POOL_DEQUE_SIZE 64
+#define BITONIC_PARALLEL_GRAIN 16384
+#define QUICK_PARALLEL_GRAIN 32768
+#define MERGE_PARALLEL_GRAIN 32768
+#define MERGE_K_PARALLEL_THRESHOLD 65536
+
+#define COUNTING_SORT_RANGE_FACTOR 4
+
+#define HEAP_SORT_D_ARY_THRESHOLD (1 << 21)
+
+#define LOSER_TREE_DONE INT64_MAX
+
+#define EXTERNAL_SORT_MEMORY ((size_t)256 << 20)
+#define EXTERNAL_SORT_FAN_IN 64
+#define EXTERNAL_SORT_MIN_BUFFER 16384
+
+#define NODE_POOL_SLAB_BYTES ((size_t)1 << 20)
+
+/* Branchless compare-exchange of two int lvalues, minimum first */
+#define CMPXCHG(a, b)				\
+	do {					\
+		int min_ = (a) < (b) ? (a) : (b);	\
+		(b) = (a) < (b) ? (b) : (a);	\
+		(a) = min_;			\
+	} while (0)
+
 /**
  * struct listint_s - Doubly linked list node
  *
@@ -21,12 +85,440 @@ typedef struct listint_s
 	struct listint_s *next;
 } listint_t;
 
+/**
+ * struct sort_tracer_s - Runtime hooks used to visualize the sorting steps
+ *
+ * @array: Called with an array (or sub-array) after a traced step
+ * @list: Called with the head of a list after a traced step
+ * @message: vprintf-like hook for the labels printed between steps
+ *
+ * Description:
+ * Every sort reports its intermediate steps through these hooks, which
+ * default to print_array, print_list and vprintf. A NULL hook is skipped,
+ * so tracing can be turned off at runtime. Building with -DSORT_NO_TRACE
+ * removes the trace points from the sorts at compile time instead.
+ */
+typedef struct sort_tracer_s
+{
+	void (*array)(const int *array, size_t size);
+	void (*list)(const listint_t *list);
+	int (*message)(const char *format, va_list args);
+} sort_tracer_t;
+
+#ifdef SORT_NO_TRACE
+#define TRACE_ARRAY(array, size) ((void)(array), (void)(size))
+#define TRACE_LIST(list) ((void)(list))
+#define TRACE_MESSAGE(args) ((void)0)
+#else
+#define TRACE_ARRAY(array, size) trace_array(array, size)
+#define TRACE_LIST(list) trace_list(list)
+#define TRACE_MESSAGE(args) trace_message args
+#endif
+
+/**
+ * struct tim_sort_s - State shared by the steps of a tim_sort call
+ *
+ * @array: The array being sorted
+ * @buffer: Scratch space for the smaller run of a merge (size / 2 ints)
+ * @min_gallop: Consecutive wins needed before a merge starts galloping
+ * @run_base: Index of the first element of each pending run
+ * @run_len: Number of elements of each pending run
+ * @runs: Number of pending runs on the stack
+ */
+typedef struct tim_sort_s
+{
+	int *array;
+	int *buffer;
+	size_t min_gallop;
+	size_t run_base[TIM_SORT_MAX_RUNS];
+	size_t run_len[TIM_SORT_MAX_RUNS];
+	size_t runs;
+} tim_sort_t;
+
+/**
+ * struct radix_chunk_s - Share of a parallel radix sort given to a thread
+ *
+ * @src: Keys read by the current pass
+ * @dst: Buffer the current pass scatters the keys to
+ * @begin: Index of the first key of the chunk
+ * @end: Index of the last key + 1 (exclusive) of the chunk
+ * @pass: Digit of the current pass, RADIX_PASSES to count every digit
+ * @counts: Number of keys of the chunk per digit, for each pass
+ * @offsets: Next slot of `dst` for each digit of the current pass
+ */
+typedef struct radix_chunk_s
+{
+	const int *src;
+	int *dst;
+	size_t begin;
+	size_t end;
+	size_t pass;
+	size_t counts[RADIX_PASSES][RADIX_BUCKETS];
+	size_t offsets[RADIX_BUCKETS];
+} radix_chunk_t;
+
+/**
+ * struct sort_task_s - Unit of work of a fork/join thread pool
+ *
+ * @routine: Routine running the task
+ * @arg: Argument passed to `routine`
+ * @done: Set once `routine` has returned, accessed atomically
+ */
+typedef struct sort_task_s
+{
+	void (*routine)(void *arg);
+	void *arg;
+	int done;
+} sort_task_t;
+
+/**
+ * struct sort_deque_s - Tasks spawned by one thread of a pool
+ *
+ * @lock: Protects the other fields
+ * @top: Count of tasks ever taken from the top (oldest end), by thieves
+ * @bottom: Count of tasks ever pushed, minus those popped back by the
+ * owner from the bottom (newest end)
+ * @tasks: Ring of queued tasks, indexed modulo SORT_POOL_DEQUE_SIZE
+ */
+typedef struct sort_deque_s
+{
+	pthread_mutex_t lock;
+	size_t top;
+	size_t bottom;
+	sort_task_t *tasks[SORT_POOL_DEQUE_SIZE];
+} sort_deque_t;
+
+/**
+ * struct sort_pool_s - Work-stealing fork/join thread pool shared by the
+ * parallel sorts
+ *
+ * @lock: Protects the sleeping of idle threads on `wake`
+ * @wake: Broadcast when a task is queued or done, or the pool stops
+ * @stop: Set to make the workers return, accessed atomically
+ * @queued: Number of tasks in all the deques, accessed atomically
+ * @sleepers: Number of threads waiting on `wake`, accessed atomically
+ * @started: Number of workers that picked their deque, accessed
+ * atomically
+ * @workers: Number of worker threads started
+ * @deque_count: Number of deques initialized, whether or not their
+ * worker could be started
+ * @threads: Worker threads
+ * @deques: One deque per thread; deque 0 belongs to the threads that are
+ * not workers of the pool, such as the caller
+ */
+typedef struct sort_pool_s
+{
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	int stop;
+	size_t queued;
+	size_t sleepers;
+	size_t started;
+	size_t workers;
+	size_t deque_count;
+	pthread_t threads[SORT_MAX_THREADS];
+	sort_deque_t deques[SORT_MAX_THREADS];
+} sort_pool_t;
+
+/**
+ * struct bitonic_task_s - Step of a parallel bitonic sort
+ *
+ * @task: Pool task running the step
+ * @pool: Pool the step spawns its sub-steps on
+ * @array: First element of the range of the step
+ * @size: Number of elements of the range
+ * @span: Distance between compared elements, or the size of the
+ * mirrored block when `flip` is set
+ * @first: Index of the first compared pair, for a comparator step
+ * @last: Index of the last compared pair + 1, for a comparator step
+ * @flip: Whether a comparator step compares mirrored elements
+ * @grain: Ranges or pairs at or under this count are not split further
+ */
+typedef struct bitonic_task_s
+{
+	sort_task_t task;
+	sort_pool_t *pool;
+	int *array;
+	size_t size;
+	size_t span;
+	size_t first;
+	size_t last;
+	int flip;
+	size_t grain;
+} bitonic_task_t;
+
+/**
+ * struct quick_task_s - Range of a parallel quick sort
+ *
+ * @task: Pool task sorting the range
+ * @pool: Pool the range forks its larger partitions on
+ * @array: Pointer to the first element of the whole array
+ * @begin: Index of the first element of the range
+ * @end: Index of the last element + 1 (exclusive) of the range
+ * @depth: Partitions left before falling back to heap_sort_bottom_up
+ * @grain: Partitions at or under this size are not forked
+ * @leftmost: Whether the range starts the array (no element before it)
+ */
+typedef struct quick_task_s
+{
+	sort_task_t task;
+	sort_pool_t *pool;
+	int *array;
+	size_t begin;
+	size_t end;
+	size_t depth;
+	size_t grain;
+	int leftmost;
+} quick_task_t;
+
+/**
+ * struct merge_task_s - Step of a parallel merge sort
+ *
+ * @task: Pool task running the step
+ * @pool: Pool the step forks its halves on
+ * @array: Range to sort, for a sort step
+ * @buffer: Range of the shared buffer matching `array`, for a sort step
+ * @size: Number of elements of the range, for a sort step
+ * @to_buffer: Whether a sort step leaves its result in `buffer`
+ * instead of `array`
+ * @left: First sorted run, for a merge step
+ * @left_size: Number of elements of `left`
+ * @right: Second sorted run, for a merge step
+ * @right_size: Number of elements of `right`
+ * @out: Destination of a merge step
+ * @grain: Ranges at or under this size are not split further
+ */
+typedef struct merge_task_s
+{
+	sort_task_t task;
+	sort_pool_t *pool;
+	int *array;
+	int *buffer;
+	size_t size;
+	int to_buffer;
+	const int *left;
+	size_t left_size;
+	const int *right;
+	size_t right_size;
+	int *out;
+	size_t grain;
+} merge_task_t;
+
+/**
+ * struct int_span_s - Read-only view of a run of integers
+ *
+ * @array: First integer of the run
+ * @size: Number of integers of the run
+ */
+typedef struct int_span_s
+{
+	const int *array;
+	size_t size;
+} int_span_t;
+
+/**
+ * struct merge_k_task_s - Slice of the output of a parallel k-way merge
+ *
+ * @spans: The sorted arrays being merged
+ * @count: Number of arrays
+ * @slices: Room for 2 * count spans: where the slice starts and ends
+ * in every array
+ * @begin: Rank of the first output element of the slice
+ * @end: Rank past the last output element of the slice
+ * @output: Destination of the whole merge
+ */
+typedef struct merge_k_task_s
+{
+	const int_span_t *spans;
+	size_t count;
+	int_span_t *slices;
+	size_t begin;
+	size_t end;
+	int *output;
+} merge_k_task_t;
+
+/**
+ * enum sort_key_e - Type of the key of the records sorted by sort_records
+ *
+ * @SORT_KEY_U32: uint32_t
+ * @SORT_KEY_U64: uint64_t
+ * @SORT_KEY_I64: int64_t
+ * @SORT_KEY_FLOAT: float
+ * @SORT_KEY_DOUBLE: double
+ */
+typedef enum sort_key_e
+{
+	SORT_KEY_U32,
+	SORT_KEY_U64,
+	SORT_KEY_I64,
+	SORT_KEY_FLOAT,
+	SORT_KEY_DOUBLE
+} sort_key_t;
+
+/**
+ * struct sort_record_key_s - Radix key of a record and its position
+ *
+ * @key: Key of the record, mapped to an unsigned integer of the same order
+ * @index: Index of the record in the array being sorted
+ */
+typedef struct sort_record_key_s
+{
+	uint64_t key;
+	size_t index;
+} sort_record_key_t;
+
+/**
+ * struct list_key_s - Radix key of a list node and the node itself
+ *
+ * @key: Value of the node, mapped to an unsigned integer of the same order
+ * @node: The node
+ */
+typedef struct list_key_s
+{
+	uint32_t key;
+	listint_t *node;
+} list_key_t;
+
+/**
+ * struct node_slab_s - Block of contiguous nodes of a node pool
+ *
+ * @next: Previously filled slab, NULL for the first one
+ * @used: Number of nodes handed out
+ * @capacity: Number of nodes of the slab, which follow this header
+ */
+typedef struct node_slab_s
+{
+	struct node_slab_s *next;
+	size_t used;
+	size_t capacity;
+} node_slab_t;
+
+/**
+ * struct node_pool_s - Arena of fixed-size list nodes
+ *
+ * @node_size: Size in bytes of one node
+ * @slab_nodes: Number of nodes of a slab, unless a larger run of
+ * contiguous nodes is requested
+ * @slabs: Slab nodes are currently taken from, linked to the older ones
+ *
+ * Description:
+ * Nodes are carved out of large slabs by bumping a counter and are
+ * never freed one by one: destroying the pool releases all of them,
+ * with one free() per slab.
+ */
+typedef struct node_pool_s
+{
+	size_t node_size;
+	size_t slab_nodes;
+	node_slab_t *slabs;
+} node_pool_t;
+
+/**
+ * struct loser_tree_s - Tournament tree selecting the smallest key of
+ * several sorted sources
+ *
+ * @ways: Number of sources
+ * @winner: Index of the source holding the smallest key
+ * @losers: Loser of the match played at each internal node, node 1
+ * being the root and node n having children 2n and 2n + 1
+ * @keys: Current key of every source, LOSER_TREE_DONE once exhausted
+ *
+ * Description:
+ * Equal keys are won by the source with the lower index, so a merge
+ * driven by the tree is stable. Any int key sorts before
+ * LOSER_TREE_DONE.
+ */
+typedef struct loser_tree_s
+{
+	size_t ways;
+	size_t winner;
+	size_t *losers;
+	int64_t *keys;
+} loser_tree_t;
+
+/**
+ * struct external_sort_options_s - Tuning of an external sort
+ *
+ * @memory: Memory budget in bytes, 0 for EXTERNAL_SORT_MEMORY
+ * @fan_in: Most runs merged at once, 0 for EXTERNAL_SORT_FAN_IN
+ * @threads: Threads sorting each run, 0 for one per online processor
+ * @temp_dir: Directory of the run files, NULL for $TMPDIR or /tmp
+ */
+typedef struct external_sort_options_s
+{
+	size_t memory;
+	size_t fan_in;
+	size_t threads;
+	const char *temp_dir;
+} external_sort_options_t;
+
+/**
+ * struct external_sort_stream_s - Buffered reader of a sorted run
+ *
+ * @file: Run file, read sequentially
+ * @buffer: Integers read from the file and not merged yet
+ * @capacity: Number of integers `buffer` can hold
+ * @length: Number of integers currently in `buffer`
+ * @position: Index of the next integer of `buffer` to merge
+ */
+typedef struct external_sort_stream_s
+{
+	FILE *file;
+	int *buffer;
+	size_t capacity;
+	size_t length;
+	size_t position;
+} external_sort_stream_t;
+
+/**
+ * struct mmap_sort_options_s - Tuning of an in-place file sort
+ *
+ * @sort: Array sort to run on the mapping, NULL for quick_sort_parallel
+ * @threads: Threads of quick_sort_parallel, 0 for one per processor
+ * @huge_pages: Whether to ask for transparent huge pages
+ * @sync: Whether to wait until the sorted file is written back
+ */
+typedef struct mmap_sort_options_s
+{
+	void (*sort)(int *array, size_t size);
+	size_t threads;
+	int huge_pages;
+	int sync;
+} mmap_sort_options_t;
+
+/**
+ * struct mmap_sort_stats_s - Memory cost of an in-place file sort
+ *
+ * @bytes: Size of the file
+ * @resident_before: Bytes of the file in the page cache before the sort
+ * @resident_after: Bytes of the file in the page cache after the sort
+ * @minor_faults: Page faults served without I/O during the sort
+ * @major_faults: Page faults that had to read from disk
+ */
+typedef struct mmap_sort_stats_s
+{
+	size_t bytes;
+	size_t resident_before;
+	size_t resident_after;
+	long minor_faults;
+	long major_faults;
+} mmap_sort_stats_t;
+
+/*
+ * libsort.so is built with -fvisibility=hidden: it only exports the entry
+ * points declared between this push and the matching pop
+ */
+#pragma GCC visibility push(default)
+
 /* print_array.c */
 void print_array(const int *array, size_t size);
 
 /* print_list.c */
 void print_list(const listint_t *list);
 
+/* trace.c */
+sort_tracer_t set_sort_tracer(const sort_tracer_t *tracer);
+
 /* 0-bubble_sort.c */
 void bubble_sort(int *array, size_t size);
 
@@ -50,6 +542,7 @@ void counting_sort(int *array, size_t size);
 
 /* 103-merge_sort */
 void merge_sort(int *array, size_t size);
+void merge_k(const int_span_t *spans, size_t count, int *output);
 
 /* 104-heap_sort */
 void heap_sort(int *array, size_t size);
@@ -63,4 +556,201 @@ void bitonic_sort(int *array, size_t size);
 /* 107-quick_sort_hoare */
 void quick_sort_hoare(int *array, size_t size);
 
+/* 108-introsort.c */
+void introsort(int *array, size_t size);
+
+/* 109-pdq_sort.c */
+void pdq_sort(int *array, size_t size);
+
+/* 110-tim_sort.c */
+void tim_sort(int *array, size_t size);
+
+/* 111-merge_sort_bottom_up.c */
+void merge_sort_bottom_up(int *array, size_t size, int *scratch);
+
+/* 112-radix_sort_lsd.c */
+void radix_sort_lsd(int *array, size_t size);
+
+/* 113-radix_sort_msd.c */
+void radix_sort_msd(int *array, size_t size);
+
+/* 114-radix_sort_parallel.c */
+void radix_sort_parallel(int *array, size_t size, int *scratch,
+			 size_t threads);
+
+/* 115-counting_sort_range.c */
+void counting_sort_range(int *array, size_t size, size_t range_factor);
+
+/* 116-heap_sort_bottom_up.c */
+void heap_sort_bottom_up(int *array, size_t size, size_t arity);
+
+/* 117-bitonic_sort_network.c */
+void bitonic_sort_network(int *array, size_t size);
+
+/* 118-bitonic_sort_parallel.c */
+void bitonic_sort_parallel(int *array, size_t size, size_t threads,
+			   size_t grain);
+
+/* 119-small_sort.c */
+void small_sort(int *array, size_t size);
+
+/* 120-quick_sort_parallel.c */
+void quick_sort_parallel(int *array, size_t size, size_t threads,
+			 size_t grain);
+
+/* 121-merge_sort_parallel.c */
+void merge_sort_parallel(int *array, size_t size, int *scratch,
+			 size_t threads, size_t grain);
+
+/* 122-merge_k_parallel.c */
+void merge_k_parallel(const int_span_t *spans, size_t count, int *output,
+		      size_t threads);
+
+/* 123-merge_sort_list.c */
+void merge_sort_list(listint_t **list);
+
+/* 124-radix_sort_list.c */
+void radix_sort_list(listint_t **list);
+
+/* external_sort.c */
+int external_sort(const char *input, const char *output,
+		  const external_sort_options_t *options);
+int external_sort_file(FILE *input, FILE *output,
+		       const external_sort_options_t *options);
+
+/* mmap_sort.c */
+int mmap_sort(const char *path, const mmap_sort_options_t *options,
+	      mmap_sort_stats_t *stats);
+
+/* node_pool.c */
+void node_pool_init(node_pool_t *pool, size_t node_size, size_t slab_nodes);
+void *node_pool_alloc(node_pool_t *pool, size_t count);
+void node_pool_destroy(node_pool_t *pool);
+
+/* list_pool.c */
+listint_t *list_pool_build(node_pool_t *pool, const int *array, size_t size);
+int list_pool_compact(node_pool_t *pool, listint_t **list);
+
+/* sort_u32.c, sort_u64.c, sort_i64.c, sort_float.c, sort_double.c */
+void quick_sort_u32(uint32_t *array, size_t size);
+void merge_sort_u32(uint32_t *array, size_t size);
+void heap_sort_u32(uint32_t *array, size_t size);
+void shell_sort_u32(uint32_t *array, size_t size);
+void radix_sort_u32(uint32_t *array, size_t size);
+
+void quick_sort_u64(uint64_t *array, size_t size);
+void merge_sort_u64(uint64_t *array, size_t size);
+void heap_sort_u64(uint64_t *array, size_t size);
+void shell_sort_u64(uint64_t *array, size_t size);
+void radix_sort_u64(uint64_t *array, size_t size);
+
+void quick_sort_i64(int64_t *array, size_t size);
+void merge_sort_i64(int64_t *array, size_t size);
+void heap_sort_i64(int64_t *array, size_t size);
+void shell_sort_i64(int64_t *array, size_t size);
+void radix_sort_i64(int64_t *array, size_t size);
+
+void quick_sort_float(float *array, size_t size);
+void merge_sort_float(float *array, size_t size);
+void heap_sort_float(float *array, size_t size);
+void shell_sort_float(float *array, size_t size);
+void radix_sort_float(float *array, size_t size);
+
+void quick_sort_double(double *array, size_t size);
+void merge_sort_double(double *array, size_t size);
+void heap_sort_double(double *array, size_t size);
+void shell_sort_double(double *array, size_t size);
+void radix_sort_double(double *array, size_t size);
+
+/* sort_records.c */
+int sort_records(void *records, size_t count, size_t size, size_t offset,
+		 sort_key_t key);
+
+#pragma GCC visibility pop
+
+/* Helpers shared by the sources of the library, hidden in libsort.so */
+
+/* trace.c */
+void trace_array(const int *array, size_t size);
+void trace_list(const listint_t *list);
+void trace_message(const char *format, ...);
+
+/* insertion_sort.c */
+void insertion_sort(int *array, size_t size);
+
+/* swap.c */
+void swap(int *a, int *b);
+void list_swap_next(listint_t **list, listint_t *node);
+void list_swap_prev(listint_t **list, listint_t *node);
+
+/* 109-pdq_sort.c */
+void pdq_sort_untraced(int *array, size_t size);
+
+/* pdq_partition.c */
+size_t pdq_partition_right(int *array, size_t begin, size_t end,
+			   int *already_partitioned);
+size_t pdq_partition_left(int *array, size_t begin, size_t end);
+int pdq_partial_insertion_sort(int *array, size_t begin, size_t end);
+void pdq_choose_pivot(int *array, size_t begin, size_t end);
+
+/* pdq_block_partition.c */
+size_t pdq_block_partition(int *array, size_t first, size_t last, int pivot);
+
+/* 112-radix_sort_lsd.c */
+void radix_histograms(const int *array, size_t size,
+		      size_t counts[RADIX_PASSES][RADIX_BUCKETS]);
+
+/* 117-bitonic_sort_network.c */
+void bitonic_half_clean(int *array, size_t size, size_t distance);
+
+/* tim_merge.c */
+void tim_merge_collapse(tim_sort_t *ts);
+void tim_merge_force_collapse(tim_sort_t *ts);
+size_t tim_gallop(int key, const int *array, size_t size, int strict,
+		  int from_end);
+
+/* tim_merge_runs.c */
+void tim_merge_lo(tim_sort_t *ts, size_t base1, size_t len1,
+		  size_t base2, size_t len2);
+void tim_merge_hi(tim_sort_t *ts, size_t base1, size_t len1,
+		  size_t base2, size_t len2);
+
+/* loser_tree.c */
+int loser_tree_init(loser_tree_t *tree, size_t ways);
+void loser_tree_destroy(loser_tree_t *tree);
+void loser_tree_build(loser_tree_t *tree);
+void loser_tree_replay(loser_tree_t *tree);
+
+/* external_sort_runs.c */
+external_sort_options_t
+external_sort_config(const external_sort_options_t *options);
+FILE *external_sort_temp(const char *dir);
+FILE **external_sort_runs(FILE *input, FILE *output,
+			  const external_sort_options_t *config,
+			  size_t *count);
+
+/* external_sort_output.c */
+FILE *external_sort_sibling(const char *path, char *temp, size_t size);
+
+/* external_sort_merge.c */
+int external_sort_merge(FILE **runs, size_t count, FILE *output,
+			size_t memory);
+
+/* threads.c */
+size_t sort_thread_count(size_t requested);
+void sort_run_parallel(void *(*routine)(void *), void *tasks,
+		       size_t task_size, size_t count);
+
+/* thread_pool.c */
+void sort_pool_init(sort_pool_t *pool, size_t threads);
+void sort_pool_destroy(sort_pool_t *pool);
+void sort_pool_spawn(sort_pool_t *pool, sort_task_t *task,
+		     void (*routine)(void *), void *arg);
+void sort_pool_join(sort_pool_t *pool, sort_task_t *task);
+
+/* thread_pool_deque.c */
+sort_task_t *sort_pool_take(sort_pool_t *pool, size_t self);
+void sort_pool_run(sort_pool_t *pool, sort_task_t *task);
+void sort_pool_sleep(sort_pool_t *pool, const int *done);
+
 #endif /* SORT_H */
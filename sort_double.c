@@ -0,0 +1,32 @@
+#include "sort.h"
+
+static uint64_t double_key(double value);
+
+/*
+ * quick_sort_double, merge_sort_double, heap_sort_double, ... on double.
+ * Every sort compares the radix keys, a total order (-0 before +0, NaNs
+ * at the ends by sign), so all of them produce the same bits.
+ */
+#define TYPED_T double
+#define TYPED_NAME(name) name##_double
+#define TYPED_LESS(a, b) (double_key(a) < double_key(b))
+#define TYPED_KEY_T uint64_t
+#define TYPED_KEY(x) double_key(x)
+#define TYPED_KEY_BYTES 8
+#include "typed_sort.h"
+
+/**
+ * double_key - Maps a double to an unsigned integer in the same order.
+ *
+ * @value: The double.
+ *
+ * Return: The radix key of `value`.
+ */
+static uint64_t double_key(double value)
+{
+	uint64_t bits;
+
+	memcpy(&bits, &value, sizeof(bits));
+
+	return (RADIX_KEY_DOUBLE(bits));
+}
@@ -0,0 +1,32 @@
+#include "sort.h"
+
+static uint32_t float_key(float value);
+
+/*
+ * quick_sort_float, merge_sort_float, heap_sort_float, ... on float.
+ * Every sort compares the radix keys, a total order (-0 before +0, NaNs
+ * at the ends by sign), so all of them produce the same bits.
+ */
+#define TYPED_T float
+#define TYPED_NAME(name) name##_float
+#define TYPED_LESS(a, b) (float_key(a) < float_key(b))
+#define TYPED_KEY_T uint32_t
+#define TYPED_KEY(x) float_key(x)
+#define TYPED_KEY_BYTES 4
+#include "typed_sort.h"
+
+/**
+ * float_key - Maps a float to an unsigned integer in the same order.
+ *
+ * @value: The float.
+ *
+ * Return: The radix key of `value`.
+ */
+static uint32_t float_key(float value)
+{
+	uint32_t bits;
+
+	memcpy(&bits, &value, sizeof(bits));
+
+	return (RADIX_KEY_FLOAT(bits));
+}
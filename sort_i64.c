@@ -0,0 +1,10 @@
+#include "sort.h"
+
+/* quick_sort_i64, merge_sort_i64, heap_sort_i64, ... on int64_t */
+#define TYPED_T int64_t
+#define TYPED_NAME(name) name##_i64
+#define TYPED_LESS(a, b) ((a) < (b))
+#define TYPED_KEY_T uint64_t
+#define TYPED_KEY(x) RADIX_KEY_I64(x)
+#define TYPED_KEY_BYTES 8
+#include "typed_sort.h"
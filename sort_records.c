@@ -0,0 +1,108 @@
+#include "sort.h"
+
+static uint64_t record_key(const unsigned char *field, sort_key_t key);
+
+/* radix_sort_record_key, falling back on heap_sort_record_key */
+#define TYPED_T sort_record_key_t
+#define TYPED_NAME(name) name##_record_key
+#define TYPED_LESS(a, b) \
+	((a).key < (b).key || ((a).key == (b).key && (a).index < (b).index))
+#define TYPED_KEY_T uint64_t
+#define TYPED_KEY(x) ((x).key)
+#define TYPED_KEY_BYTES 8
+#define TYPED_LINKAGE static
+#include "typed_heap.h"
+#include "typed_radix.h"
+#undef TYPED_T
+#undef TYPED_NAME
+#undef TYPED_LESS
+#undef TYPED_KEY_T
+#undef TYPED_KEY
+#undef TYPED_KEY_BYTES
+#undef TYPED_LINKAGE
+
+/**
+ * sort_records - Sorts an array of fixed-size records by a key stored
+ * inside each record.
+ *
+ * @records: Pointer to the first record.
+ * @count: Number of records.
+ * @size: Size in bytes of one record.
+ * @offset: Offset in bytes of the key within a record.
+ * @key: Type of the key.
+ *
+ * Description:
+ * The records are not moved while sorting: every key is read once
+ * into a (key, index) pair, the 16-byte pairs are radix sorted, and the
+ * records are then gathered once in their final order. The key is
+ * mapped to an unsigned integer of the same order when it is read, so
+ * one radix sort serves every key type, and bytes that no key uses
+ * (e.g. the upper half of 32-bit keys) cost no pass. The sort is
+ * stable.
+ *
+ * Return: 0 on success, -1 if the memory for the pairs and the gather
+ * buffer (count * (16 + size) bytes) cannot be allocated, in which case
+ * the records are left untouched.
+ */
+int sort_records(void *records, size_t count, size_t size, size_t offset,
+		 sort_key_t key)
+{
+	unsigned char *base = records, *buffer;
+	sort_record_key_t *keys;
+	size_t i;
+
+	if (!records || count < 2)
+		return (0);
+
+	keys = malloc(sizeof(*keys) * count);
+	buffer = malloc(size * count);
+	if (!keys || !buffer)
+	{
+		free(keys);
+		free(buffer);
+		return (-1);
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		keys[i].key = record_key(base + size * i + offset, key);
+		keys[i].index = i;
+	}
+	radix_sort_record_key(keys, count);
+
+	for (i = 0; i < count; i++)
+		memcpy(buffer + size * i, base + size * keys[i].index, size);
+	memcpy(base, buffer, size * count);
+
+	free(keys);
+	free(buffer);
+	return (0);
+}
+
+/**
+ * record_key - Reads the key of a record.
+ *
+ * @field: Pointer to the key, which may be unaligned.
+ * @key: Type of the key.
+ *
+ * Return: The key mapped to an unsigned integer of the same order.
+ */
+static uint64_t record_key(const unsigned char *field, sort_key_t key)
+{
+	uint32_t bits32;
+	uint64_t bits64;
+
+	if (key == SORT_KEY_U32 || key == SORT_KEY_FLOAT)
+	{
+		memcpy(&bits32, field, sizeof(bits32));
+		return (key == SORT_KEY_U32 ? bits32 : RADIX_KEY_FLOAT(bits32));
+	}
+
+	memcpy(&bits64, field, sizeof(bits64));
+	if (key == SORT_KEY_I64)
+		return (bits64 ^ ((uint64_t)1 << 63));
+	if (key == SORT_KEY_DOUBLE)
+		return (RADIX_KEY_DOUBLE(bits64));
+
+	return (bits64);
+}
@@ -0,0 +1,10 @@
+#include "sort.h"
+
+/* quick_sort_u32, merge_sort_u32, heap_sort_u32, ... on uint32_t */
+#define TYPED_T uint32_t
+#define TYPED_NAME(name) name##_u32
+#define TYPED_LESS(a, b) ((a) < (b))
+#define TYPED_KEY_T uint32_t
+#define TYPED_KEY(x) (x)
+#define TYPED_KEY_BYTES 4
+#include "typed_sort.h"
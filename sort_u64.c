@@ -0,0 +1,10 @@
+#include "sort.h"
+
+/* quick_sort_u64, merge_sort_u64, heap_sort_u64, ... on uint64_t */
+#define TYPED_T uint64_t
+#define TYPED_NAME(name) name##_u64
+#define TYPED_LESS(a, b) ((a) < (b))
+#define TYPED_KEY_T uint64_t
+#define TYPED_KEY(x) (x)
+#define TYPED_KEY_BYTES 8
+#include "typed_sort.h"
@@ -0,0 +1,169 @@
+#include "sort.h"
+
+static void *sort_pool_worker(void *pool);
+
+/* Pool and deque of the current thread, when it is a pool worker */
+static __thread sort_pool_t *current_pool;
+static __thread size_t current_deque;
+
+/**
+ * sort_pool_init - Starts the workers of a work-stealing thread pool.
+ *
+ * @pool: Pointer to the pool to initialize.
+ * @threads: Number of threads taking part, the caller included, so
+ * `threads - 1` workers are started (at most SORT_MAX_THREADS - 1).
+ *
+ * Description:
+ * Every thread owns a deque: it pushes and pops its own tasks at the
+ * bottom, and idle threads steal the oldest task at the top of another
+ * deque, which in a divide-and-conquer sort is the largest one left.
+ * Workers that cannot be created are simply not counted: with no worker
+ * at all, sort_pool_spawn runs every task inline.
+ */
+void sort_pool_init(sort_pool_t *pool, size_t threads)
+{
+	size_t i;
+
+	threads = threads < SORT_MAX_THREADS ? threads : SORT_MAX_THREADS;
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	pool->stop = 0;
+	pool->queued = 0;
+	pool->sleepers = 0;
+	pool->started = 0;
+	pool->workers = 0;
+	pool->deque_count = threads;
+	for (i = 0; i < threads; i++)
+	{
+		pthread_mutex_init(&pool->deques[i].lock, NULL);
+		pool->deques[i].top = 0;
+		pool->deques[i].bottom = 0;
+	}
+
+	/* Running workers already read the count to scan the deques */
+	for (i = 1; i < threads; i++)
+		if (pthread_create(&pool->threads[pool->workers], NULL,
+				   sort_pool_worker, pool) == 0)
+			__atomic_add_fetch(&pool->workers, 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * sort_pool_destroy - Stops and joins the workers of a pool.
+ *
+ * @pool: Pointer to the pool, with no task left to join.
+ */
+void sort_pool_destroy(sort_pool_t *pool)
+{
+	size_t i;
+
+	pthread_mutex_lock(&pool->lock);
+	__atomic_store_n(&pool->stop, 1, __ATOMIC_SEQ_CST);
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (i = 0; i < pool->workers; i++)
+		pthread_join(pool->threads[i], NULL);
+
+	for (i = 0; i < pool->deque_count; i++)
+		pthread_mutex_destroy(&pool->deques[i].lock);
+	pthread_cond_destroy(&pool->wake);
+	pthread_mutex_destroy(&pool->lock);
+}
+
+/**
+ * sort_pool_spawn - Pushes a task on the deque of the calling thread,
+ * from where any thread of the pool may run it.
+ *
+ * @pool: Pointer to the pool.
+ * @task: Pointer to the task, which must stay alive until joined.
+ * @routine: Routine to run.
+ * @arg: Argument passed to `routine`.
+ *
+ * Description:
+ * When the pool has no worker or the deque is full, the task runs
+ * inline, which bounds the memory and overhead of deep recursions.
+ */
+void sort_pool_spawn(sort_pool_t *pool, sort_task_t *task,
+		     void (*routine)(void *), void *arg)
+{
+	sort_deque_t *deque;
+
+	task->routine = routine;
+	task->arg = arg;
+	task->done = 0;
+	deque = &pool->deques[current_pool == pool ? current_deque : 0];
+
+	pthread_mutex_lock(&deque->lock);
+	if (!pool->workers ||
+	    deque->bottom - deque->top == SORT_POOL_DEQUE_SIZE)
+	{
+		pthread_mutex_unlock(&deque->lock);
+		routine(arg);
+		task->done = 1;
+		return;
+	}
+	deque->tasks[deque->bottom++ % SORT_POOL_DEQUE_SIZE] = task;
+	pthread_mutex_unlock(&deque->lock);
+
+	__atomic_add_fetch(&pool->queued, 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&pool->sleepers, __ATOMIC_SEQ_CST))
+	{
+		pthread_mutex_lock(&pool->lock);
+		pthread_cond_broadcast(&pool->wake);
+		pthread_mutex_unlock(&pool->lock);
+	}
+}
+
+/**
+ * sort_pool_join - Waits for a spawned task to be done.
+ *
+ * @pool: Pointer to the pool.
+ * @task: Pointer to the task.
+ *
+ * Description:
+ * Instead of blocking, the caller runs tasks while it waits: its own
+ * newest one first, usually `task` itself, then tasks stolen from the
+ * other threads. It only sleeps when there is nothing left to run.
+ */
+void sort_pool_join(sort_pool_t *pool, sort_task_t *task)
+{
+	size_t self = current_pool == pool ? current_deque : 0;
+	sort_task_t *next;
+
+	while (!__atomic_load_n(&task->done, __ATOMIC_SEQ_CST))
+	{
+		next = sort_pool_take(pool, self);
+		if (next)
+			sort_pool_run(pool, next);
+		else
+			sort_pool_sleep(pool, &task->done);
+	}
+}
+
+/**
+ * sort_pool_worker - Runs and steals tasks until the pool is stopped.
+ *
+ * @pool: Pointer to the pool.
+ *
+ * Return: Always NULL.
+ */
+static void *sort_pool_worker(void *pool)
+{
+	sort_pool_t *self = pool;
+	sort_task_t *task;
+
+	current_pool = self;
+	current_deque = __atomic_add_fetch(&self->started, 1,
+					   __ATOMIC_SEQ_CST);
+
+	while (!__atomic_load_n(&self->stop, __ATOMIC_SEQ_CST))
+	{
+		task = sort_pool_take(self, current_deque);
+		if (task)
+			sort_pool_run(self, task);
+		else
+			sort_pool_sleep(self, NULL);
+	}
+
+	return (NULL);
+}
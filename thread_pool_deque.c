@@ -0,0 +1,92 @@
+#include "sort.h"
+
+/**
+ * sort_pool_take - Takes a task to run from the deques of a pool.
+ *
+ * @pool: Pointer to the pool.
+ * @self: Index of the deque of the calling thread.
+ *
+ * Description:
+ * The newest task of the own deque comes first, as it is the hottest in
+ * cache and usually the one being joined. Otherwise the oldest task of
+ * the next non-empty deque is stolen.
+ *
+ * Return: The task, or NULL if every deque is empty.
+ */
+sort_task_t *sort_pool_take(sort_pool_t *pool, size_t self)
+{
+	size_t count = __atomic_load_n(&pool->workers, __ATOMIC_SEQ_CST) + 1;
+	size_t i;
+	sort_deque_t *deque;
+	sort_task_t *task = NULL;
+
+	if (!__atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST))
+		return (NULL);
+
+	for (i = 0; i < count && !task; i++)
+	{
+		deque = &pool->deques[(self + i) % count];
+		pthread_mutex_lock(&deque->lock);
+		if (deque->bottom != deque->top)
+		{
+			if (i == 0)
+				task = deque->tasks[--deque->bottom %
+						    SORT_POOL_DEQUE_SIZE];
+			else
+				task = deque->tasks[deque->top++ %
+						    SORT_POOL_DEQUE_SIZE];
+		}
+		pthread_mutex_unlock(&deque->lock);
+	}
+
+	if (task)
+		__atomic_sub_fetch(&pool->queued, 1, __ATOMIC_SEQ_CST);
+
+	return (task);
+}
+
+/**
+ * sort_pool_run - Runs a task taken from a pool and marks it done.
+ *
+ * @pool: Pointer to the pool.
+ * @task: Pointer to the task.
+ */
+void sort_pool_run(sort_pool_t *pool, sort_task_t *task)
+{
+	task->routine(task->arg);
+	__atomic_store_n(&task->done, 1, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(&pool->sleepers, __ATOMIC_SEQ_CST))
+	{
+		pthread_mutex_lock(&pool->lock);
+		pthread_cond_broadcast(&pool->wake);
+		pthread_mutex_unlock(&pool->lock);
+	}
+}
+
+/**
+ * sort_pool_sleep - Waits until a pool has queued tasks, is stopped, or
+ * a task is done.
+ *
+ * @pool: Pointer to the pool.
+ * @done: Pointer to the `done` flag of the task being joined, or NULL.
+ *
+ * Description:
+ * The sleeper is counted before checking the conditions, and whoever
+ * changes one of them checks the count afterwards, so a wake-up cannot
+ * be missed. Returning does not mean there is work, only that it is
+ * worth looking again.
+ */
+void sort_pool_sleep(sort_pool_t *pool, const int *done)
+{
+	pthread_mutex_lock(&pool->lock);
+	__atomic_add_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+
+	if (!__atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST) &&
+	    !__atomic_load_n(&pool->stop, __ATOMIC_SEQ_CST) &&
+	    !(done && __atomic_load_n(done, __ATOMIC_SEQ_CST)))
+		pthread_cond_wait(&pool->wake, &pool->lock);
+
+	__atomic_sub_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+	pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,63 @@
+#include <unistd.h>
+#include "sort.h"
+
+/**
+ * sort_thread_count - Resolves the number of threads a parallel sort
+ * should use.
+ *
+ * @requested: Number of threads asked for by the caller, 0 for one per
+ * online processor.
+ *
+ * Return: The number of threads to use, at least 1.
+ */
+size_t sort_thread_count(size_t requested)
+{
+	long online;
+
+	if (requested)
+		return (requested);
+
+	online = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (online > 0 ? (size_t)online : 1);
+}
+
+/**
+ * sort_run_parallel - Runs a routine on every task of an array, one
+ * thread per task, and waits for all of them.
+ *
+ * @routine: Routine to run, called with a pointer to its task.
+ * @tasks: Pointer to the first task.
+ * @task_size: Size in bytes of one task.
+ * @count: Number of tasks.
+ *
+ * Description:
+ * The first task runs on the calling thread, and so does any task
+ * whose thread cannot be created or that exceeds SORT_MAX_THREADS, so
+ * the work is always done, just with less parallelism.
+ */
+void sort_run_parallel(void *(*routine)(void *), void *tasks,
+		       size_t task_size, size_t count)
+{
+	pthread_t threads[SORT_MAX_THREADS];
+	int started[SORT_MAX_THREADS];
+	char *task = tasks;
+	size_t i;
+
+	for (i = 1; i < count && i < SORT_MAX_THREADS; i++)
+	{
+		started[i] = pthread_create(&threads[i], NULL, routine,
+					    task + i * task_size) == 0;
+		if (!started[i])
+			routine(task + i * task_size);
+	}
+
+	for (i = SORT_MAX_THREADS; i < count; i++)
+		routine(task + i * task_size);
+	if (count)
+		routine(task);
+
+	for (i = 1; i < count && i < SORT_MAX_THREADS; i++)
+		if (started[i])
+			pthread_join(threads[i], NULL);
+}
@@ -0,0 +1,172 @@
+#include "sort.h"
+
+static void tim_merge_at(tim_sort_t *ts, size_t i);
+static size_t bound(int key, const int *array, size_t lo, size_t hi,
+		    int strict);
+
+/**
+ * tim_merge_collapse - Merges pending runs until their lengths are
+ * balanced again.
+ *
+ * @ts: Pointer to the state of the sort.
+ *
+ * Description:
+ * The lengths on the run stack must satisfy, from the top down,
+ * len[i - 2] > len[i - 1] + len[i] and len[i - 1] > len[i]; the
+ * invariant is also checked one level deeper, which the original
+ * TimSort omitted. This bounds the stack to O(log n) runs and keeps
+ * the merges balanced.
+ */
+void tim_merge_collapse(tim_sort_t *ts)
+{
+	size_t n, *len = ts->run_len;
+
+	while (ts->runs > 1)
+	{
+		n = ts->runs - 2;
+		if ((n > 0 && len[n - 1] <= len[n] + len[n + 1]) ||
+		    (n > 1 && len[n - 2] <= len[n - 1] + len[n]))
+		{
+			if (len[n - 1] < len[n + 1])
+				n--;
+		}
+		else if (len[n] > len[n + 1])
+		{
+			break;
+		}
+
+		tim_merge_at(ts, n);
+	}
+}
+
+/**
+ * tim_merge_force_collapse - Merges every pending run into one.
+ *
+ * @ts: Pointer to the state of the sort.
+ */
+void tim_merge_force_collapse(tim_sort_t *ts)
+{
+	size_t n, *len = ts->run_len;
+
+	while (ts->runs > 1)
+	{
+		n = ts->runs - 2;
+		if (n > 0 && len[n - 1] < len[n + 1])
+			n--;
+		tim_merge_at(ts, n);
+	}
+}
+
+/**
+ * tim_merge_at - Merges the runs at index i and i + 1 of the stack.
+ *
+ * @ts: Pointer to the state of the sort.
+ * @i: Index of the first run, either the second or third from the top.
+ *
+ * Description:
+ * The elements of the first run that are already in place (smaller
+ * than the head of the second) and the elements of the second run
+ * already in place (greater than the tail of the first) are skipped
+ * with gallops, then the rest is merged through a copy of the
+ * smaller of the two remaining runs.
+ */
+static void tim_merge_at(tim_sort_t *ts, size_t i)
+{
+	int *array = ts->array;
+	size_t base1 = ts->run_base[i], len1 = ts->run_len[i];
+	size_t base2 = ts->run_base[i + 1], len2 = ts->run_len[i + 1], k;
+
+	ts->run_len[i] = len1 + len2;
+	if (i == ts->runs - 3)
+	{
+		ts->run_base[i + 1] = ts->run_base[i + 2];
+		ts->run_len[i + 1] = ts->run_len[i + 2];
+	}
+	ts->runs--;
+
+	k = tim_gallop(array[base2], array + base1, len1, 0, 0);
+	base1 += k;
+	len1 -= k;
+	if (len1 == 0)
+		return;
+
+	len2 = tim_gallop(array[base1 + len1 - 1], array + base2, len2, 1, 1);
+	if (len2 == 0)
+		return;
+
+	if (len1 <= len2)
+		tim_merge_lo(ts, base1, len1, base2, len2);
+	else
+		tim_merge_hi(ts, base1, len1, base2, len2);
+}
+
+/**
+ * tim_gallop - Finds where a key belongs in a sorted array with an
+ * exponential search.
+ *
+ * @key: Value to locate.
+ * @array: Pointer to the first element of the sorted array.
+ * @size: Number of elements in the array.
+ * @strict: 1 to count the elements less than `key` (lower bound),
+ * 0 to count the elements less than or equal to `key` (upper bound).
+ * @from_end: 1 to start probing from the end of the array, 0 from
+ * the beginning.
+ *
+ * Description:
+ * Probing at distances 1, 3, 7, 15... costs O(log k) comparisons when
+ * the answer is k elements away from the starting end, which is what
+ * makes long runs of wins from the same side cheap to skip.
+ *
+ * Return: The number of elements that belong before `key`.
+ */
+size_t tim_gallop(int key, const int *array, size_t size, int strict,
+	      int from_end)
+{
+	size_t lo = 0, hi = size, ofs = 1;
+
+	if (!from_end)
+	{
+		while (ofs <= size && (strict ? array[ofs - 1] < key :
+				       array[ofs - 1] <= key))
+			lo = ofs, ofs = ofs * 2 + 1;
+		hi = ofs <= size ? ofs - 1 : size;
+	}
+	else
+	{
+		while (ofs <= size && !(strict ? array[size - ofs] < key :
+					array[size - ofs] <= key))
+			hi = size - ofs, ofs = ofs * 2 + 1;
+		lo = ofs <= size ? size - ofs + 1 : 0;
+	}
+
+	return (bound(key, array, lo, hi, strict));
+}
+
+/**
+ * bound - Binary searches the insertion point of a key in a range.
+ *
+ * @key: Value to locate.
+ * @array: Pointer to the first element of the sorted array.
+ * @lo: First index the answer can be.
+ * @hi: Last index the answer can be.
+ * @strict: 1 for the lower bound, 0 for the upper bound of `key`.
+ *
+ * Return: The index of the first element that does not belong before
+ * `key`, in [lo, hi].
+ */
+static size_t bound(int key, const int *array, size_t lo, size_t hi,
+		    int strict)
+{
+	size_t mid;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (strict ? array[mid] < key : array[mid] <= key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return (lo);
+}
@@ -0,0 +1,128 @@
+#include "sort.h"
+
+static void gallop_feedback(tim_sort_t *ts, size_t won1, size_t won2,
+			    size_t *count1, size_t *count2);
+
+/**
+ * tim_merge_lo - Merges two adjacent runs, the first being the smaller.
+ *
+ * @ts: Pointer to the state of the sort.
+ * @base1: Index of the first element of the first run.
+ * @len1: Length of the first run.
+ * @base2: Index of the first element of the second run (base1 + len1).
+ * @len2: Length of the second run.
+ *
+ * Description:
+ * Only the first run is copied to the buffer; the merge fills the array
+ * from the left and can never overtake the unread part of the second
+ * run, so nothing is copied back. After a run wins `min_gallop` times
+ * in a row, whole stretches are located with tim_gallop and moved at once.
+ */
+void tim_merge_lo(tim_sort_t *ts, size_t base1, size_t len1,
+		  size_t base2, size_t len2)
+{
+	int *array = ts->array, *tmp = ts->buffer;
+	size_t a = 0, b = base2, dest = base1, end = base2 + len2;
+	size_t count1 = 0, count2 = 0, won1, won2;
+
+	memcpy(tmp, array + base1, len1 * sizeof(int));
+	while (a < len1 && b < end)
+	{
+		if (count1 < ts->min_gallop && count2 < ts->min_gallop)
+		{
+			if (array[b] < tmp[a])
+				array[dest++] = array[b++], count2++, count1 = 0;
+			else
+				array[dest++] = tmp[a++], count1++, count2 = 0;
+			continue;
+		}
+
+		won1 = tim_gallop(array[b], tmp + a, len1 - a, 0, 0);
+		memcpy(array + dest, tmp + a, won1 * sizeof(int));
+		dest += won1, a += won1;
+		if (a == len1)
+			break;
+		won2 = tim_gallop(tmp[a], array + b, end - b, 1, 0);
+		memmove(array + dest, array + b, won2 * sizeof(int));
+		dest += won2, b += won2;
+		gallop_feedback(ts, won1, won2, &count1, &count2);
+	}
+
+	memcpy(array + dest, tmp + a, (len1 - a) * sizeof(int));
+}
+
+/**
+ * tim_merge_hi - Merges two adjacent runs, the second being the smaller.
+ *
+ * @ts: Pointer to the state of the sort.
+ * @base1: Index of the first element of the first run.
+ * @len1: Length of the first run.
+ * @base2: Index of the first element of the second run (base1 + len1).
+ * @len2: Length of the second run.
+ *
+ * Description:
+ * Mirror image of tim_merge_lo: the second run is copied to the buffer
+ * and the array is filled from the right.
+ */
+void tim_merge_hi(tim_sort_t *ts, size_t base1, size_t len1,
+		  size_t base2, size_t len2)
+{
+	int *array = ts->array, *tmp = ts->buffer;
+	size_t a = base1 + len1, b = len2, dest = base2 + len2;
+	size_t count1 = 0, count2 = 0, won1, won2;
+
+	memcpy(tmp, array + base2, len2 * sizeof(int));
+	while (a > base1 && b > 0)
+	{
+		if (count1 < ts->min_gallop && count2 < ts->min_gallop)
+		{
+			if (tmp[b - 1] < array[a - 1])
+				array[--dest] = array[--a], count1++, count2 = 0;
+			else
+				array[--dest] = tmp[--b], count2++, count1 = 0;
+			continue;
+		}
+
+		won1 = a - base1;
+		won1 -= tim_gallop(tmp[b - 1], array + base1, won1, 0, 1);
+		dest -= won1, a -= won1;
+		memmove(array + dest, array + a, won1 * sizeof(int));
+		if (a == base1)
+			break;
+		won2 = b - tim_gallop(array[a - 1], tmp, b, 1, 1);
+		dest -= won2, b -= won2;
+		memcpy(array + dest, tmp + b, won2 * sizeof(int));
+		gallop_feedback(ts, won1, won2, &count1, &count2);
+	}
+
+	memcpy(array + dest - b, tmp, b * sizeof(int));
+}
+
+/**
+ * gallop_feedback - Adapts the galloping threshold after a gallop round.
+ *
+ * @ts: Pointer to the state of the sort.
+ * @won1: Number of elements the first run won in a row.
+ * @won2: Number of elements the second run won in a row.
+ * @count1: Pointer to the one-at-a-time win streak of the first run.
+ * @count2: Pointer to the one-at-a-time win streak of the second run.
+ *
+ * Description:
+ * Galloping pays off on structured data and costs extra comparisons on
+ * random data, so every fruitful round lowers the threshold and a
+ * fruitless one raises it and resumes one-at-a-time merging.
+ */
+static void gallop_feedback(tim_sort_t *ts, size_t won1, size_t won2,
+			    size_t *count1, size_t *count2)
+{
+	if (won1 >= TIM_SORT_MIN_GALLOP || won2 >= TIM_SORT_MIN_GALLOP)
+	{
+		if (ts->min_gallop > 1)
+			ts->min_gallop--;
+		return;
+	}
+
+	ts->min_gallop += 2;
+	*count1 = 0;
+	*count2 = 0;
+}
@@ -0,0 +1,142 @@
+#include <errno.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "sort.h"
+
+static int parse_options(int argc, char **argv,
+			 external_sort_options_t *options, int *report);
+static int sort_streams(const char *input, const char *output,
+			const external_sort_options_t *options);
+static void print_stats(void);
+
+/**
+ * main - Sorts a binary file of native int32 values that may be larger
+ * than the available memory.
+ *
+ * @argc: Number of arguments.
+ * @argv: Arguments: [-m MiB] [-k fan-in] [-j threads] [-T dir] [-s]
+ * input output, where "-" stands for the standard input or output.
+ *
+ * Return: 0 on success, 1 on a usage error, 2 if the sort fails.
+ */
+int main(int argc, char **argv)
+{
+	external_sort_options_t options = {0, 0, 0, NULL};
+	const char *input, *output;
+	int status, report = 0;
+
+	if (parse_options(argc, argv, &options, &report) ||
+	    argc - optind != 2)
+	{
+		fprintf(stderr, "usage: %s [-m MiB] [-k fan-in] [-j threads]"
+			" [-T dir] [-s] input output\n", argv[0]);
+		return (1);
+	}
+
+	input = argv[optind];
+	output = argv[optind + 1];
+	if (!strcmp(input, "-") || !strcmp(output, "-"))
+		status = sort_streams(input, output, &options);
+	else
+		status = external_sort(input, output, &options);
+	if (status)
+	{
+		perror(argv[0]);
+		return (2);
+	}
+	if (report)
+		print_stats();
+
+	return (0);
+}
+
+/**
+ * parse_options - Reads the command line options.
+ *
+ * @argc: Number of arguments.
+ * @argv: Arguments.
+ * @options: Options of the sort, filled from the command line.
+ * @report: Set if the statistics are asked for.
+ *
+ * Return: 0 on success, -1 on an unknown option or an invalid number.
+ */
+static int parse_options(int argc, char **argv,
+			 external_sort_options_t *options, int *report)
+{
+	unsigned long value = 0;
+	char *end;
+	int option;
+
+	while ((option = getopt(argc, argv, "m:k:j:T:s")) != -1)
+	{
+		if (option == 's')
+			*report = 1;
+		if (option == 'T')
+			options->temp_dir = optarg;
+		if (option == 's' || option == 'T')
+			continue;
+		if (option == '?')
+			return (-1);
+		errno = 0;
+		value = strtoul(optarg, &end, 10);
+		if (errno || end == optarg || *end)
+			return (-1);
+		if (option == 'm')
+			options->memory = (size_t)value << 20;
+		else if (option == 'k')
+			options->fan_in = value;
+		else
+			options->threads = value;
+	}
+
+	return (0);
+}
+
+/**
+ * sort_streams - Sorts when the input or the output is a standard
+ * stream.
+ *
+ * @input: Path of the input, "-" for the standard input.
+ * @output: Path of the output, "-" for the standard output.
+ * @options: Options of the sort.
+ *
+ * Return: 0 on success, -1 with errno set on failure.
+ */
+static int sort_streams(const char *input, const char *output,
+			const external_sort_options_t *options)
+{
+	FILE *in = stdin, *out = stdout;
+	int status = -1;
+
+	if (strcmp(input, "-"))
+		in = fopen(input, "rb");
+	if (in && strcmp(output, "-"))
+		out = fopen(output, "wb");
+	if (in && out)
+		status = external_sort_file(in, out, options);
+
+	if (in && in != stdin)
+		fclose(in);
+	if (out && out != stdout && fclose(out))
+		status = -1;
+
+	return (status);
+}
+
+/**
+ * print_stats - Prints the page faults and block I/O of the process to
+ * the standard error, for comparison with mmap_sort -s.
+ */
+static void print_stats(void)
+{
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage))
+		return;
+	fprintf(stderr, "blocks read:     %ld\n"
+		"blocks written:  %ld\n"
+		"minor faults:    %ld\n"
+		"major faults:    %ld\n",
+		usage.ru_inblock, usage.ru_oublock,
+		usage.ru_minflt, usage.ru_majflt);
+}
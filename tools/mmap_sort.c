@@ -0,0 +1,148 @@
+#include <errno.h>
+#include <unistd.h>
+#include "sort.h"
+
+static int parse_options(int argc, char **argv,
+			 mmap_sort_options_t *options, int *report);
+static void (*pick_sort(const char *name))(int *, size_t);
+static void heap_sort_floyd(int *array, size_t size);
+static void print_stats(const mmap_sort_stats_t *stats);
+
+/**
+ * main - Sorts a binary file of native int32 values in place through a
+ * memory mapping.
+ *
+ * @argc: Number of arguments.
+ * @argv: Arguments: [-j threads] [-a quick|pdq|heap|radix] [-H] [-S]
+ * [-s] file.
+ *
+ * Return: 0 on success, 1 on a usage error, 2 if the sort fails.
+ */
+int main(int argc, char **argv)
+{
+	mmap_sort_options_t options = {NULL, 0, 0, 0};
+	mmap_sort_stats_t stats;
+	int report = 0;
+
+	if (parse_options(argc, argv, &options, &report) ||
+	    argc - optind != 1)
+	{
+		fprintf(stderr, "usage: %s [-j threads] [-a quick|pdq|heap|"
+			"radix] [-H] [-S] [-s] file\n", argv[0]);
+		return (1);
+	}
+
+	set_sort_tracer(NULL);
+	if (mmap_sort(argv[optind], &options, &stats))
+	{
+		perror(argv[0]);
+		return (2);
+	}
+	if (report)
+		print_stats(&stats);
+
+	return (0);
+}
+
+/**
+ * parse_options - Reads the command line options.
+ *
+ * @argc: Number of arguments.
+ * @argv: Arguments.
+ * @options: Options of the sort, filled from the command line.
+ * @report: Set if the statistics are asked for.
+ *
+ * Return: 0 on success, -1 on an unknown option or an invalid value.
+ */
+static int parse_options(int argc, char **argv,
+			 mmap_sort_options_t *options, int *report)
+{
+	char *end;
+	int option;
+
+	while ((option = getopt(argc, argv, "j:a:HSs")) != -1)
+	{
+		if (option == 'j')
+		{
+			errno = 0;
+			options->threads = strtoul(optarg, &end, 10);
+			if (errno || end == optarg || *end)
+				return (-1);
+		}
+		else if (option == 'a')
+		{
+			options->sort = pick_sort(optarg);
+			if (!options->sort && strcmp(optarg, "quick"))
+				return (-1);
+		}
+		else if (option == 'H')
+			options->huge_pages = 1;
+		else if (option == 'S')
+			options->sync = 1;
+		else if (option == 's')
+			*report = 1;
+		else
+			return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * pick_sort - Finds the array sort of a name.
+ *
+ * @name: "pdq", "heap" or "radix".
+ *
+ * Description:
+ * "radix" is radix_sort_msd, which sorts in place: radix_sort_lsd needs
+ * a buffer as large as the file and returns unsorted if it cannot get it.
+ *
+ * Return: The sort, or NULL for any other name (quick_sort_parallel).
+ */
+static void (*pick_sort(const char *name))(int *, size_t)
+{
+	if (!strcmp(name, "pdq"))
+		return (pdq_sort);
+	if (!strcmp(name, "heap"))
+		return (heap_sort_floyd);
+	if (!strcmp(name, "radix"))
+		return (radix_sort_msd);
+
+	return (NULL);
+}
+
+/**
+ * heap_sort_floyd - Sorts with heap_sort_bottom_up and its default
+ * arity.
+ *
+ * @array: Pointer to the array of integers to be sorted.
+ * @size: Size of the array.
+ */
+static void heap_sort_floyd(int *array, size_t size)
+{
+	heap_sort_bottom_up(array, size, 0);
+}
+
+/**
+ * print_stats - Prints the page cache residency and page faults of a
+ * sort to the standard error.
+ *
+ * @stats: Statistics of the sort.
+ */
+static void print_stats(const mmap_sort_stats_t *stats)
+{
+	size_t paged_in = stats->resident_after > stats->resident_before ?
+		stats->resident_after - stats->resident_before : 0;
+
+	fprintf(stderr, "bytes:           %lu\n"
+		"resident before: %lu\n"
+		"resident after:  %lu\n"
+		"paged in:        %lu\n"
+		"minor faults:    %ld\n"
+		"major faults:    %ld\n",
+		(unsigned long)stats->bytes,
+		(unsigned long)stats->resident_before,
+		(unsigned long)stats->resident_after,
+		(unsigned long)paged_in,
+		stats->minor_faults, stats->major_faults);
+}
@@ -0,0 +1,73 @@
+#include "sort.h"
+
+static sort_tracer_t tracer = {print_array, print_list, vprintf};
+
+/**
+ * set_sort_tracer - Replaces the hooks used to trace the sorting steps.
+ *
+ * @hooks: Pointer to the new hooks, or NULL to disable tracing entirely.
+ *
+ * Description:
+ * The hooks are copied, so the caller does not need to keep `hooks`
+ * alive. Passing NULL silences every sort at runtime; the previous
+ * hooks are returned so they can be restored later.
+ *
+ * Return: The hooks that were installed before the call.
+ */
+sort_tracer_t set_sort_tracer(const sort_tracer_t *hooks)
+{
+	sort_tracer_t previous = tracer;
+
+	if (hooks)
+	{
+		tracer = *hooks;
+	}
+	else
+	{
+		tracer.array = NULL;
+		tracer.list = NULL;
+		tracer.message = NULL;
+	}
+
+	return (previous);
+}
+
+/**
+ * trace_array - Reports an intermediate state of an array.
+ *
+ * @array: Pointer to the first element to report.
+ * @size: Number of elements to report.
+ */
+void trace_array(const int *array, size_t size)
+{
+	if (tracer.array)
+		tracer.array(array, size);
+}
+
+/**
+ * trace_list - Reports an intermediate state of a linked list.
+ *
+ * @list: Pointer to the head of the list.
+ */
+void trace_list(const listint_t *list)
+{
+	if (tracer.list)
+		tracer.list(list);
+}
+
+/**
+ * trace_message - Reports a formatted label between two traced steps.
+ *
+ * @format: printf-like format string.
+ */
+void trace_message(const char *format, ...)
+{
+	va_list args;
+
+	if (!tracer.message)
+		return;
+
+	va_start(args, format);
+	tracer.message(format, args);
+	va_end(args);
+}
@@ -0,0 +1,76 @@
+/*
+ * typed_heap.h - Heap sort of the typed_sort.h template.
+ */
+
+#ifndef TYPED_LINKAGE
+#define TYPED_LINKAGE
+#endif
+
+TYPED_LINKAGE void TYPED_NAME(heap_sort)(TYPED_T *array, size_t size);
+static void TYPED_NAME(typed_sift)(TYPED_T *array, size_t root,
+				   size_t size, TYPED_T value);
+
+/**
+ * heap_sort - Sorts an array of TYPED_T with a bottom-up heap sort.
+ *
+ * @array: Pointer to the array to be sorted.
+ * @size: Number of elements of the array.
+ *
+ * Description:
+ * Same algorithm as heap_sort_bottom_up on a binary heap. It needs no
+ * memory, which makes it the fallback of the other typed sorts.
+ */
+TYPED_LINKAGE void TYPED_NAME(heap_sort)(TYPED_T *array, size_t size)
+{
+	TYPED_T value;
+	size_t i;
+
+	if (!array || size < 2)
+		return;
+
+	for (i = size / 2; i-- > 0;)
+		TYPED_NAME(typed_sift)(array, i, size, array[i]);
+	for (i = size - 1; i > 0; i--)
+	{
+		value = array[i];
+		array[i] = array[0];
+		TYPED_NAME(typed_sift)(array, 0, i, value);
+	}
+}
+
+/**
+ * typed_sift - Places a value in the hole at the root of a sub-heap.
+ *
+ * @array: Pointer to the heap.
+ * @root: Index of the hole.
+ * @size: Number of elements of the heap.
+ * @value: Value to place.
+ *
+ * Description:
+ * Floyd's sift: the hole walks down to a leaf along the larger
+ * children, then the value climbs back up to its place, which is
+ * usually close to the leaf.
+ */
+static void TYPED_NAME(typed_sift)(TYPED_T *array, size_t root,
+				   size_t size, TYPED_T value)
+{
+	size_t hole = root, child, parent;
+
+	while ((child = 2 * hole + 1) < size)
+	{
+		child += child + 1 < size &&
+			TYPED_LESS(array[child], array[child + 1]);
+		array[hole] = array[child];
+		hole = child;
+	}
+
+	while (hole > root)
+	{
+		parent = (hole - 1) / 2;
+		if (!TYPED_LESS(array[parent], value))
+			break;
+		array[hole] = array[parent];
+		hole = parent;
+	}
+	array[hole] = value;
+}
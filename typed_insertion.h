@@ -0,0 +1,27 @@
+/*
+ * typed_insertion.h - Insertion sort of the typed_sort.h template, the
+ * leaf sort of its quick and merge sorts.
+ */
+
+static void TYPED_NAME(typed_insertion)(TYPED_T *array, size_t size);
+
+/**
+ * typed_insertion - Sorts a small array by insertion, moving elements
+ * instead of swapping them.
+ *
+ * @array: Pointer to the array to be sorted.
+ * @size: Number of elements of the array.
+ */
+static void TYPED_NAME(typed_insertion)(TYPED_T *array, size_t size)
+{
+	TYPED_T value;
+	size_t i, j;
+
+	for (i = 1; i < size; i++)
+	{
+		value = array[i];
+		for (j = i; j && TYPED_LESS(value, array[j - 1]); j--)
+			array[j] = array[j - 1];
+		array[j] = value;
+	}
+}
@@ -0,0 +1,85 @@
+/*
+ * typed_merge.h - Merge sort of the typed_sort.h template.
+ */
+
+TYPED_LINKAGE void TYPED_NAME(merge_sort)(TYPED_T *array, size_t size);
+static void TYPED_NAME(typed_merge_pass)(const TYPED_T *src, TYPED_T *dst,
+					 size_t size, size_t width);
+
+/**
+ * merge_sort - Sorts an array of TYPED_T with a stable bottom-up merge
+ * sort.
+ *
+ * @array: Pointer to the array to be sorted.
+ * @size: Number of elements of the array.
+ *
+ * Description:
+ * Blocks of TYPED_INSERTION_THRESHOLD elements are sorted by insertion,
+ * then merged pairwise in passes that ping-pong between the array and
+ * one buffer, as in merge_sort_bottom_up. If the buffer cannot be
+ * allocated the array is heap sorted instead, which is not stable.
+ */
+TYPED_LINKAGE void TYPED_NAME(merge_sort)(TYPED_T *array, size_t size)
+{
+	TYPED_T *buffer, *src = array, *dst, *tmp;
+	size_t width, i;
+
+	if (!array || size < 2)
+		return;
+
+	for (i = 0; i < size; i += TYPED_INSERTION_THRESHOLD)
+		TYPED_NAME(typed_insertion)(array + i, size - i <
+					    TYPED_INSERTION_THRESHOLD ?
+					    size - i :
+					    TYPED_INSERTION_THRESHOLD);
+	if (size <= TYPED_INSERTION_THRESHOLD)
+		return;
+
+	buffer = malloc(sizeof(*buffer) * size);
+	if (!buffer)
+	{
+		TYPED_NAME(heap_sort)(array, size);
+		return;
+	}
+
+	dst = buffer;
+	for (width = TYPED_INSERTION_THRESHOLD; width < size; width *= 2)
+	{
+		TYPED_NAME(typed_merge_pass)(src, dst, size, width);
+		tmp = src, src = dst, dst = tmp;
+	}
+
+	if (src != array)
+		memcpy(array, src, sizeof(*array) * size);
+	free(buffer);
+}
+
+/**
+ * typed_merge_pass - Merges every pair of adjacent sorted runs.
+ *
+ * @src: Pointer to the runs.
+ * @dst: Pointer receiving the merged runs.
+ * @size: Number of elements.
+ * @width: Length of the runs, the last one may be shorter.
+ */
+static void TYPED_NAME(typed_merge_pass)(const TYPED_T *src, TYPED_T *dst,
+					 size_t size, size_t width)
+{
+	size_t low, middle, high, i, j, k;
+
+	for (low = 0; low < size; low += 2 * width)
+	{
+		middle = size - low < width ? size : low + width;
+		high = size - middle < width ? size : middle + width;
+		i = low, j = middle, k = low;
+
+		/* Ties are taken from the left run, which keeps it stable */
+		while (i < middle && j < high)
+			dst[k++] = TYPED_LESS(src[j], src[i]) ?
+				src[j++] : src[i++];
+		while (i < middle)
+			dst[k++] = src[i++];
+		while (j < high)
+			dst[k++] = src[j++];
+	}
+}
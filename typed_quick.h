@@ -0,0 +1,115 @@
+/*
+ * typed_quick.h - Quick sort of the typed_sort.h template.
+ */
+
+TYPED_LINKAGE void TYPED_NAME(quick_sort)(TYPED_T *array, size_t size);
+static void TYPED_NAME(typed_quick_loop)(TYPED_T *array, size_t size,
+					 size_t depth);
+static size_t TYPED_NAME(typed_partition)(TYPED_T *array, size_t size);
+
+/**
+ * quick_sort - Sorts an array of TYPED_T with an introspective quick
+ * sort.
+ *
+ * @array: Pointer to the array to be sorted.
+ * @size: Number of elements of the array.
+ *
+ * Description:
+ * Hoare partitions around a median of three, as in introsort: the
+ * smaller side is sorted recursively and the larger one in a loop, so
+ * the stack stays O(log n). Partitions of TYPED_INSERTION_THRESHOLD
+ * elements or less are finished by insertion, and past 2 * log2(n)
+ * levels the partition is heap sorted, which bounds the worst case to
+ * O(n log n).
+ */
+TYPED_LINKAGE void TYPED_NAME(quick_sort)(TYPED_T *array, size_t size)
+{
+	size_t depth = 0, n;
+
+	if (!array || size < 2)
+		return;
+
+	for (n = size; n > 1; n >>= 1)
+		depth += 2;
+	TYPED_NAME(typed_quick_loop)(array, size, depth);
+}
+
+/**
+ * typed_quick_loop - Sorts a partition and its sub-partitions.
+ *
+ * @array: Pointer to the partition.
+ * @size: Number of elements of the partition.
+ * @depth: Number of partitioning levels left before heap sort.
+ */
+static void TYPED_NAME(typed_quick_loop)(TYPED_T *array, size_t size,
+					 size_t depth)
+{
+	size_t split;
+
+	while (size > TYPED_INSERTION_THRESHOLD)
+	{
+		if (!depth--)
+		{
+			TYPED_NAME(heap_sort)(array, size);
+			return;
+		}
+
+		split = TYPED_NAME(typed_partition)(array, size);
+		if (split < size - split)
+		{
+			TYPED_NAME(typed_quick_loop)(array, split, depth);
+			array += split;
+			size -= split;
+		}
+		else
+		{
+			TYPED_NAME(typed_quick_loop)(array + split,
+						     size - split, depth);
+			size = split;
+		}
+	}
+
+	TYPED_NAME(typed_insertion)(array, size);
+}
+
+/**
+ * typed_partition - Splits a partition around the median of its first,
+ * middle and last elements.
+ *
+ * @array: Pointer to the partition, of at least 3 elements.
+ * @size: Number of elements of the partition.
+ *
+ * Description:
+ * Sorting the three candidates first leaves a sentinel at each end, so
+ * the Hoare scans need no bound checks.
+ *
+ * Return: The number of elements of the left part, every one of them
+ * not greater than any element of the right part. Both parts are
+ * non-empty.
+ */
+static size_t TYPED_NAME(typed_partition)(TYPED_T *array, size_t size)
+{
+	size_t i = 0, j = size - 1, middle = size / 2;
+	TYPED_T pivot, tmp;
+
+	if (TYPED_LESS(array[middle], array[0]))
+		tmp = array[0], array[0] = array[middle], array[middle] = tmp;
+	if (TYPED_LESS(array[j], array[middle]))
+		tmp = array[j], array[j] = array[middle], array[middle] = tmp;
+	if (TYPED_LESS(array[middle], array[0]))
+		tmp = array[0], array[0] = array[middle], array[middle] = tmp;
+	pivot = array[middle];
+
+	for (;;)
+	{
+		while (TYPED_LESS(array[i], pivot))
+			i++;
+		while (TYPED_LESS(pivot, array[j]))
+			j--;
+		if (i >= j)
+			return (j + 1);
+		tmp = array[i], array[i] = array[j], array[j] = tmp;
+		i++;
+		j--;
+	}
+}
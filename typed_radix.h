@@ -0,0 +1,111 @@
+/*
+ * typed_radix.h - Radix sort of the typed_sort.h template. It falls
+ * back to the heap sort of typed_heap.h, which must be included first.
+ */
+
+#ifndef TYPED_LINKAGE
+#define TYPED_LINKAGE
+#endif
+
+/* Byte `pass` of the radix key of element x */
+#define TYPED_DIGIT(x, pass) ((size_t)(TYPED_KEY(x) >> ((pass) * 8)) & 0xff)
+
+TYPED_LINKAGE void TYPED_NAME(radix_sort)(TYPED_T *array, size_t size);
+static void TYPED_NAME(typed_histograms)(const TYPED_T *array, size_t size,
+					 size_t counts[][RADIX_BUCKETS]);
+static void TYPED_NAME(typed_scatter)(const TYPED_T *src, TYPED_T *dst,
+				      size_t size, size_t pass,
+				      const size_t *counts);
+
+/**
+ * radix_sort - Sorts an array of TYPED_T with a stable LSD radix sort on
+ * the bytes of its keys.
+ *
+ * @array: Pointer to the array to be sorted.
+ * @size: Number of elements of the array.
+ *
+ * Description:
+ * As in radix_sort_lsd: all the byte histograms are built in one read
+ * pass, a byte that is the same in every key is skipped, and the other
+ * passes ping-pong between the array and one buffer. If the buffer
+ * cannot be allocated the array is heap sorted instead.
+ */
+TYPED_LINKAGE void TYPED_NAME(radix_sort)(TYPED_T *array, size_t size)
+{
+	size_t counts[TYPED_KEY_BYTES][RADIX_BUCKETS], pass;
+	TYPED_T *buffer, *src = array, *dst, *tmp;
+
+	if (!array || size < 2)
+		return;
+
+	buffer = malloc(sizeof(*buffer) * size);
+	if (!buffer)
+	{
+		TYPED_NAME(heap_sort)(array, size);
+		return;
+	}
+
+	dst = buffer;
+	TYPED_NAME(typed_histograms)(array, size, counts);
+	for (pass = 0; pass < TYPED_KEY_BYTES; pass++)
+	{
+		if (counts[pass][TYPED_DIGIT(array[0], pass)] == size)
+			continue;
+		TYPED_NAME(typed_scatter)(src, dst, size, pass, counts[pass]);
+		tmp = src, src = dst, dst = tmp;
+	}
+
+	if (src != array)
+		memcpy(array, src, sizeof(*array) * size);
+	free(buffer);
+}
+
+/**
+ * typed_histograms - Counts the occurrences of every byte of every pass.
+ *
+ * @array: Pointer to the elements.
+ * @size: Number of elements.
+ * @counts: Receives, for each pass, the number of elements per byte.
+ */
+static void TYPED_NAME(typed_histograms)(const TYPED_T *array, size_t size,
+					 size_t counts[][RADIX_BUCKETS])
+{
+	TYPED_KEY_T key;
+	size_t i, pass;
+
+	memset(counts, 0, sizeof(size_t) * TYPED_KEY_BYTES * RADIX_BUCKETS);
+	for (i = 0; i < size; i++)
+	{
+		key = TYPED_KEY(array[i]);
+		for (pass = 0; pass < TYPED_KEY_BYTES; pass++)
+			counts[pass][(key >> (pass * 8)) & 0xff]++;
+	}
+}
+
+/**
+ * typed_scatter - Distributes the elements by one byte of their keys,
+ * keeping their order.
+ *
+ * @src: Pointer to the elements to distribute.
+ * @dst: Pointer receiving the distributed elements.
+ * @size: Number of elements.
+ * @pass: Index of the byte, 0 being the least significant.
+ * @counts: Number of elements per byte for this pass.
+ */
+static void TYPED_NAME(typed_scatter)(const TYPED_T *src, TYPED_T *dst,
+				      size_t size, size_t pass,
+				      const size_t *counts)
+{
+	size_t offsets[RADIX_BUCKETS], i, total = 0;
+
+	for (i = 0; i < RADIX_BUCKETS; i++)
+	{
+		offsets[i] = total;
+		total += counts[i];
+	}
+
+	for (i = 0; i < size; i++)
+		dst[offsets[TYPED_DIGIT(src[i], pass)]++] = src[i];
+}
+
+#undef TYPED_DIGIT
@@ -0,0 +1,42 @@
+/*
+ * typed_shell.h - Shell sort of the typed_sort.h template.
+ */
+
+TYPED_LINKAGE void TYPED_NAME(shell_sort)(TYPED_T *array, size_t size);
+
+/**
+ * shell_sort - Sorts an array of TYPED_T with a Shell sort on the Knuth
+ * sequence.
+ *
+ * @array: Pointer to the array to be sorted.
+ * @size: Number of elements of the array.
+ *
+ * Description:
+ * Same gaps as shell_sort, with each gapped insertion moving elements
+ * instead of swapping them.
+ */
+TYPED_LINKAGE void TYPED_NAME(shell_sort)(TYPED_T *array, size_t size)
+{
+	size_t gap = 1, i, j;
+	TYPED_T value;
+
+	if (!array || size < 2)
+		return;
+
+	while (gap < size)
+		gap = gap * 3 + 1;
+	for (gap = (gap - 1) / 3; gap; gap = (gap - 1) / 3)
+	{
+		for (i = gap; i < size; i++)
+		{
+			value = array[i];
+			for (j = i; j >= gap; j -= gap)
+			{
+				if (!TYPED_LESS(value, array[j - gap]))
+					break;
+				array[j] = array[j - gap];
+			}
+			array[j] = value;
+		}
+	}
+}
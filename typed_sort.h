@@ -0,0 +1,41 @@
+/*
+ * typed_sort.h - Template of the typed array sorts.
+ *
+ * Not a regular header: every inclusion generates quick_sort, merge_sort,
+ * heap_sort, shell_sort and radix_sort for one element type, with the
+ * comparison expanded inline rather than called through a pointer. The
+ * including file defines:
+ *
+ *   TYPED_T              the element type
+ *   TYPED_NAME(name)     the name of a generated function, e.g.
+ *                        name##_u64
+ *   TYPED_LESS(a, b)     whether element a sorts before element b
+ *   TYPED_KEY_T          an unsigned integer type
+ *   TYPED_KEY(x)         a TYPED_KEY_T that orders like element x, for
+ *                        the radix sort
+ *   TYPED_KEY_BYTES      the number of low bytes of the key that vary
+ *   TYPED_LINKAGE        optional, e.g. static; public by default
+ *
+ * The parameters are undefined at the end, so the template can be
+ * included again for another type. typed_heap.h and typed_radix.h can
+ * also be included alone, in that order.
+ */
+
+#ifndef TYPED_LINKAGE
+#define TYPED_LINKAGE
+#endif
+
+#include "typed_insertion.h"
+#include "typed_heap.h"
+#include "typed_shell.h"
+#include "typed_quick.h"
+#include "typed_merge.h"
+#include "typed_radix.h"
+
+#undef TYPED_T
+#undef TYPED_NAME
+#undef TYPED_LESS
+#undef TYPED_KEY_T
+#undef TYPED_KEY
+#undef TYPED_KEY_BYTES
+#undef TYPED_LINKAGE